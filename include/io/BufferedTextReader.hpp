@@ -18,14 +18,23 @@
 #ifndef IO_BUFFEREDTEXTREADER_HPP
 #define IO_BUFFEREDTEXTREADER_HPP
 
+#include <future>
 #include <istream>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::io
 {
 /**
  * @brief Provides mechanisms to read textual data partially buffered in memory.
+ *
+ * The buffer grows while data is read sequentially and shrinks back to its
+ * initial size when seeking outside of it. Optionally, the chunk following
+ * the buffer is read on a background thread while the current chunk is
+ * consumed.
  */
 class BufferedTextReader
 {
@@ -33,18 +42,28 @@ public:
     /**
      * @brief Constructs from stream.
      * @param streamPtr An open input stream.
-     * @param bufferSize The size of the buffer in bytes.
+     * @param bufferSize The initial size of the buffer in bytes.
+     * @param readAhead Whether to read the next chunk on a background thread.
+     * Ignored if threads are not available.
      */
     explicit BufferedTextReader(std::unique_ptr<std::istream> streamPtr,
-        size_t bufferSize = s_bufferDefaultMaxSize);
+        size_t bufferSize = s_bufferDefaultSize, bool readAhead = false);
 
     /**
      * @brief Constructs from file.
      * @param filePath Path to the file.
-     * @param bufferSize The size of the buffer in bytes.
+     * @param bufferSize The initial size of the buffer in bytes.
+     * @param readAhead Whether to read the next chunk on a background thread.
+     * Ignored if threads are not available.
      */
     explicit BufferedTextReader(const std::string& filePath,
-        size_t bufferSize = s_bufferDefaultMaxSize);
+        size_t bufferSize = s_bufferDefaultSize, bool readAhead = false);
+
+    BufferedTextReader(const BufferedTextReader&) = delete;
+    BufferedTextReader& operator=(const BufferedTextReader&) = delete;
+    BufferedTextReader(BufferedTextReader&&) = delete;
+    BufferedTextReader& operator=(BufferedTextReader&&) = delete;
+    ~BufferedTextReader();
 
     /**
      * @brief tellg Get the current read position in the data.
@@ -59,10 +78,11 @@ public:
         std::ios_base::seekdir seekdir = std::ios_base::beg);
 
     /**
-     * @brief getLength The length (in chars) of the input data.
+     * @brief getLength The length (in chars) of the input data. Determined
+     * once on construction.
      * @return Total length (in chars) of the input data.
      */
-    std::ios::pos_type getLength();
+    [[nodiscard]] std::ios::pos_type getLength() const;
 
     /**
      * @brief eof End of file reached?
@@ -80,18 +100,52 @@ public:
      */
     std::string readLine();
 
+    /**
+     * @brief readLineView Reads one line of text terminated by \\r\\n or \\n
+     * without creating a new string.
+     * @return A view of the line read without trailing \\n or \\r\\n. The
+     * view is only valid until the next call of a non-const method of this
+     * reader.
+     */
+    std::string_view readLineView();
+
+    /**
+     * @brief Moves the read position back to the start of the line read last,
+     * e.g., after reading the first line of the next LDR. Avoids querying the
+     * position before each line read.
+     * @throws std::runtime_error If no line has been read since construction,
+     * the last seek, or the last unread.
+     */
+    void unreadLine();
+
 private:
-    static constexpr size_t s_bufferDefaultMaxSize = 4 * 1024;
+    static constexpr size_t s_bufferDefaultSize = 4 * 1024;
+    static constexpr size_t s_bufferMaxSize = 1024 * 1024;
     std::unique_ptr<std::istream> m_streamPtr;
+    std::ios::pos_type m_length;
+    size_t m_bufferInitialSize;
     size_t m_bufferMaxSize;
+    size_t m_chunkSize;
     std::vector<char> m_buffer;
     std::ios::pos_type m_bufferBasePos;
     std::vector<char>::const_iterator m_bufferPosIt;
+    std::string m_line;
+    std::optional<std::ios::pos_type> m_lineStartPos;
+    bool m_readAhead;
+    std::vector<char> m_nextBuffer;
+    std::ios::pos_type m_nextBufferBasePos;
+    // only accesses the stream and m_nextBuffer while valid
+    std::future<void> m_readAheadResult;
 
     void setStreamFlags();
     std::ios::pos_type calculateAbsolutePosition(
         std::ios::pos_type position, std::ios_base::seekdir seekdir);
     void updateBuffer(std::ios::pos_type position);
+    void loadNextChunk();
+    void readChunk(std::vector<char>& buffer, std::ios::pos_type position,
+        size_t size);
+    void startReadAhead();
+    void finishReadAhead();
 };
 } // namespace libjdx::io
 
@@ -0,0 +1,186 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef IO_MAPPEDTEXTREADER_HPP
+#define IO_MAPPEDTEXTREADER_HPP
+
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libjdx::io
+{
+/**
+ * @brief Provides mechanisms to read textual data held completely in memory.
+ *
+ * Regular files are memory mapped if the platform supports it, otherwise (and
+ * for other files and streams) the data is copied into memory once on
+ * construction. Shared buffers are used without copying. Positioning and line
+ * reading then only require pointer arithmetic.
+ *
+ * @note If a mapped file is truncated by another process while being read,
+ * accessing the lost part of the mapping raises SIGBUS, which terminates the
+ * process. Truncation is detected on seekg(), but not during line reads. Use
+ * BufferedTextReader for files that may be modified while being read.
+ *
+ * Additional readers with their own read position over the same data can be
+ * created with createCursor(), e.g., for reading on multiple threads.
+ */
+class MappedTextReader
+{
+public:
+    /**
+     * @brief Constructs from stream. The stream is read completely.
+     * @param streamPtr An open input stream.
+     */
+    explicit MappedTextReader(std::unique_ptr<std::istream> streamPtr);
+
+    /**
+     * @brief Constructs from file.
+     * @param filePath Path to the file.
+     */
+    explicit MappedTextReader(const std::string& filePath);
+
+    /**
+     * @brief Checks whether a file can be read by this reader without undue
+     * risk, i.e., it does not reside on a FUSE file system, where files may
+     * change or vanish without notice. Files that are not regular files (e.g.,
+     * pipes or virtual files in /proc) are never mapped but read into memory.
+     * @param filePath Path to the file.
+     * @return True if the file can be read safely, false otherwise.
+     */
+    [[nodiscard]] static bool isMappingSafe(const std::string& filePath);
+
+    /**
+     * @brief Constructs from a buffer in memory without copying it.
+     * @param buffer The data. Kept alive as long as this reader or any of its
+     * cursors exist and must not be modified meanwhile.
+     * @throws std::invalid_argument If the buffer is null.
+     */
+    explicit MappedTextReader(std::shared_ptr<const std::vector<char>> buffer);
+
+    MappedTextReader(const MappedTextReader&) = delete;
+    MappedTextReader& operator=(const MappedTextReader&) = delete;
+    MappedTextReader(MappedTextReader&&) = delete;
+    MappedTextReader& operator=(MappedTextReader&&) = delete;
+    ~MappedTextReader();
+
+    /**
+     * @brief Get the current read position in the data.
+     * @return The current read position.
+     */
+    [[nodiscard]] std::ios::pos_type tellg() const;
+
+    /**
+     * @brief Set the read position in the data.
+     * @throws std::runtime_error If the position is outside of the data or a
+     * mapped file has been truncated.
+     */
+    void seekg(std::ios::off_type,
+        std::ios_base::seekdir seekdir = std::ios_base::beg);
+
+    /**
+     * @brief The length (in chars) of the input data.
+     * @return Total length (in chars) of the input data.
+     */
+    [[nodiscard]] std::ios::pos_type getLength() const;
+
+    /**
+     * @brief End of file reached?
+     * @return True if end of file reached, false otherwise.
+     *
+     * @note The behavior of this method deviates from isteram.eof(). This
+     * method returns true when the EOF has been reached without the need for a
+     * previous failing read operation.
+     */
+    [[nodiscard]] bool eof() const;
+
+    /**
+     * @brief readLine Reads one line of text terminated by \\r\\n or \\n.
+     * @return The line read without trailing \\n or \\r\\n.
+     */
+    std::string readLine();
+
+    /**
+     * @brief readLineView Reads one line of text terminated by \\r\\n or \\n
+     * without creating a new string.
+     * @return A view of the line read without trailing \\n or \\r\\n. The
+     * view is only valid until the next call of a non-const method of this
+     * reader.
+     */
+    std::string_view readLineView();
+
+    /**
+     * @brief Moves the read position back to the start of the line read last,
+     * e.g., after reading the first line of the next LDR. Avoids querying the
+     * position before each line read.
+     * @throws std::runtime_error If no line has been read since construction,
+     * the last seek, or the last unread.
+     */
+    void unreadLine();
+
+    /**
+     * @brief Creates a reader over the same data with its own read position.
+     * The data is shared, not copied, and stays valid as long as any reader
+     * using it exists. Different readers may be used concurrently.
+     * @return A new reader positioned at the start of the data.
+     */
+    [[nodiscard]] std::unique_ptr<MappedTextReader> createCursor() const;
+
+private:
+    /**
+     * @brief The immutable data shared by all cursors.
+     */
+    struct Source
+    {
+        std::vector<char> buffer;
+        std::shared_ptr<const std::vector<char>> sharedBuffer;
+        void* mapping = nullptr;
+        size_t mappingSize = 0;
+        // kept open to detect truncation of the mapped file
+        int fd = -1;
+
+        [[nodiscard]] const char* data() const;
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool isTruncated() const;
+
+        Source() = default;
+        Source(const Source&) = delete;
+        Source& operator=(const Source&) = delete;
+        Source(Source&&) = delete;
+        Source& operator=(Source&&) = delete;
+        ~Source();
+    };
+
+    std::shared_ptr<const Source> m_source;
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+    std::optional<size_t> m_lineStart;
+
+    explicit MappedTextReader(std::shared_ptr<const Source> source);
+    static std::shared_ptr<const Source> mapFile(const std::string& filePath);
+    static void readFile(const std::string& filePath, Source& source);
+    static std::shared_ptr<const Source> wrapBuffer(
+        std::shared_ptr<const std::vector<char>> buffer);
+};
+} // namespace libjdx::io
+
+#endif
@@ -20,6 +20,9 @@
 
 #include <istream>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace libjdx::io
 {
@@ -75,8 +78,28 @@ public:
      */
     std::string readLine();
 
+    /**
+     * @brief readLineView Reads one line of text terminated by \\r\\n or \\n
+     * without creating a new string.
+     * @return A view of the line read without trailing \\n or \\r\\n. The
+     * view is only valid until the next call of a non-const method of this
+     * reader.
+     */
+    std::string_view readLineView();
+
+    /**
+     * @brief Moves the read position back to the start of the line read last,
+     * e.g., after reading the first line of the next LDR. Avoids querying the
+     * position before each line read.
+     * @throws std::runtime_error If no line has been read since construction,
+     * the last seek, or the last unread.
+     */
+    void unreadLine();
+
 private:
     std::unique_ptr<std::istream> m_streamPtr;
+    std::string m_line;
+    std::optional<std::ios::off_type> m_lineLength;
 
     void setStreamFlags();
 };
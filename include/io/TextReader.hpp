@@ -18,21 +18,297 @@
 #ifndef IO_TEXTREADER_HPP
 #define IO_TEXTREADER_HPP
 
-#ifdef __EMSCRIPTEN__
-#include "io/BufferedTextReader.hpp"
-#else
-#include "io/SimpleTextReader.hpp"
-#endif
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace libjdx::io
 {
-// use BufferedTextReader for EMSCRIPTEN build as it drastically improves data
-// reading performance in browser context
-#ifdef __EMSCRIPTEN__
-typedef BufferedTextReader TextReader;
-#else
-typedef SimpleTextReader TextReader;
-#endif
-}
+/**
+ * @brief The reader implementations available for reading textual data.
+ */
+enum class TextReaderType
+{
+    /**
+     * @brief Choose the implementation depending on platform and data.
+     */
+    Auto,
+    /**
+     * @brief MappedTextReader.
+     */
+    Mapped,
+    /**
+     * @brief BufferedTextReader.
+     */
+    Buffered,
+    /**
+     * @brief SimpleTextReader.
+     */
+    Simple,
+};
+
+/**
+ * @brief Provides mechanisms to read textual data with a reader
+ * implementation chosen at runtime.
+ *
+ * Any reader providing the methods of this class can be wrapped. By default,
+ * BufferedTextReader is used for the EMSCRIPTEN build as it drastically
+ * improves data reading performance in browser context and MappedTextReader
+ * is used for native builds as it avoids istream overhead for line reads and
+ * turns seeks into pointer arithmetic. Files that can not be mapped safely
+ * (see MappedTextReader::isMappingSafe()) are read with BufferedTextReader.
+ *
+ * @note Truncating a memory mapped file while it is being read may terminate
+ * the process with SIGBUS, see MappedTextReader.
+ */
+class TextReader
+{
+public:
+    /**
+     * @brief Constructs from stream with the platform's default reader.
+     * @param streamPtr An open input stream.
+     */
+    explicit TextReader(std::unique_ptr<std::istream> streamPtr);
+
+    /**
+     * @brief Constructs from file with the platform's default reader.
+     * @param filePath Path to the file.
+     */
+    explicit TextReader(const std::string& filePath);
+
+    /**
+     * @brief Constructs from a specific reader.
+     * @param readerPtr The reader to wrap.
+     */
+    template<typename Reader,
+        typename = std::enable_if_t<!std::is_base_of_v<std::istream, Reader>>>
+    explicit TextReader(std::unique_ptr<Reader> readerPtr)
+        : m_reader{std::make_unique<Model<Reader>>(std::move(readerPtr))}
+    {
+        if (m_reader->isNull())
+        {
+            throw std::runtime_error("Text reader is null.");
+        }
+    }
+
+    TextReader(const TextReader&) = delete;
+    TextReader& operator=(const TextReader&) = delete;
+    TextReader(TextReader&&) = delete;
+    TextReader& operator=(TextReader&&) = delete;
+    ~TextReader();
+
+    /**
+     * @brief Get the current read position in the data.
+     * @return The current read position.
+     */
+    [[nodiscard]] std::ios::pos_type tellg() const
+    {
+        return m_reader->tellg();
+    }
+
+    /**
+     * @brief Set the read position in the data.
+     */
+    void seekg(std::ios::off_type position,
+        std::ios_base::seekdir seekdir = std::ios_base::beg)
+    {
+        m_reader->seekg(position, seekdir);
+    }
+
+    /**
+     * @brief The length (in chars) of the input data.
+     * @return Total length (in chars) of the input data.
+     */
+    [[nodiscard]] std::ios::pos_type getLength() const
+    {
+        return m_reader->getLength();
+    }
+
+    /**
+     * @brief End of file reached?
+     * @return True if end of file reached, false otherwise.
+     *
+     * @note The behavior of this method deviates from isteram.eof(). This
+     * method returns true when the EOF has been reached without the need for a
+     * previous failing read operation.
+     */
+    [[nodiscard]] bool eof() const
+    {
+        return m_reader->eof();
+    }
+
+    /**
+     * @brief readLine Reads one line of text terminated by \\r\\n or \\n.
+     * @return The line read without trailing \\n or \\r\\n.
+     */
+    std::string readLine()
+    {
+        return m_reader->readLine();
+    }
+
+    /**
+     * @brief readLineView Reads one line of text terminated by \\r\\n or \\n
+     * without creating a new string.
+     * @return A view of the line read without trailing \\n or \\r\\n. The
+     * view is only valid until the next call of a non-const method of this
+     * reader.
+     */
+    std::string_view readLineView()
+    {
+        return m_reader->readLineView();
+    }
+
+    /**
+     * @brief Moves the read position back to the start of the line read last.
+     * @throws std::runtime_error If no line has been read since construction,
+     * the last seek, or the last unread.
+     */
+    void unreadLine()
+    {
+        m_reader->unreadLine();
+    }
+
+    /**
+     * @brief Whether the wrapped reader supports createCursor().
+     * @return True if cursors can be created, false otherwise.
+     */
+    [[nodiscard]] bool canCreateCursor() const
+    {
+        return m_reader->canCreateCursor();
+    }
+
+    /**
+     * @brief Creates a reader over the same data with its own read position.
+     * Different readers may be used concurrently.
+     * @return A new reader positioned at the start of the data.
+     * @throws std::runtime_error If the wrapped reader does not support
+     * cursors.
+     */
+    [[nodiscard]] std::unique_ptr<TextReader> createCursor() const;
+
+private:
+    template<typename Reader, typename = void>
+    struct HasCreateCursor : std::false_type
+    {
+    };
+
+    template<typename Reader>
+    struct HasCreateCursor<Reader,
+        std::void_t<decltype(std::declval<const Reader&>().createCursor())>>
+        : std::true_type
+    {
+    };
+
+    /**
+     * @brief The interface the wrapped readers are accessed through.
+     */
+    class Concept
+    {
+    public:
+        Concept() = default;
+        Concept(const Concept&) = delete;
+        Concept& operator=(const Concept&) = delete;
+        Concept(Concept&&) = delete;
+        Concept& operator=(Concept&&) = delete;
+        virtual ~Concept() = default;
+
+        [[nodiscard]] virtual bool isNull() const = 0;
+        [[nodiscard]] virtual std::ios::pos_type tellg() const = 0;
+        virtual void seekg(
+            std::ios::off_type position, std::ios_base::seekdir seekdir)
+            = 0;
+        [[nodiscard]] virtual std::ios::pos_type getLength() const = 0;
+        [[nodiscard]] virtual bool eof() const = 0;
+        virtual std::string readLine() = 0;
+        virtual std::string_view readLineView() = 0;
+        virtual void unreadLine() = 0;
+        [[nodiscard]] virtual bool canCreateCursor() const = 0;
+        [[nodiscard]] virtual std::unique_ptr<Concept> createCursor() const
+            = 0;
+    };
+
+    template<typename Reader>
+    class Model final : public Concept
+    {
+    public:
+        explicit Model(std::unique_ptr<Reader> readerPtr)
+            : m_readerPtr{std::move(readerPtr)}
+        {
+        }
+
+        [[nodiscard]] bool isNull() const override
+        {
+            return m_readerPtr == nullptr;
+        }
+
+        [[nodiscard]] std::ios::pos_type tellg() const override
+        {
+            return m_readerPtr->tellg();
+        }
+
+        void seekg(std::ios::off_type position,
+            std::ios_base::seekdir seekdir) override
+        {
+            m_readerPtr->seekg(position, seekdir);
+        }
+
+        [[nodiscard]] std::ios::pos_type getLength() const override
+        {
+            return m_readerPtr->getLength();
+        }
+
+        [[nodiscard]] bool eof() const override
+        {
+            return m_readerPtr->eof();
+        }
+
+        std::string readLine() override
+        {
+            return m_readerPtr->readLine();
+        }
+
+        std::string_view readLineView() override
+        {
+            return m_readerPtr->readLineView();
+        }
+
+        void unreadLine() override
+        {
+            m_readerPtr->unreadLine();
+        }
+
+        [[nodiscard]] bool canCreateCursor() const override
+        {
+            return HasCreateCursor<Reader>::value;
+        }
+
+        [[nodiscard]] std::unique_ptr<Concept> createCursor() const override
+        {
+            if constexpr (HasCreateCursor<Reader>::value)
+            {
+                return std::make_unique<Model<Reader>>(
+                    m_readerPtr->createCursor());
+            }
+            else
+            {
+                throw std::runtime_error(
+                    "Text reader does not support cursors.");
+            }
+        }
+
+    private:
+        std::unique_ptr<Reader> m_readerPtr;
+    };
+
+    std::unique_ptr<Concept> m_reader;
+
+    explicit TextReader(std::unique_ptr<Concept> reader);
+    static std::unique_ptr<Concept> openFile(const std::string& filePath);
+};
+} // namespace libjdx::io
 
 #endif
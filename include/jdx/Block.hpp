@@ -24,6 +24,7 @@
 #include "jdx/BrukerSpecificParameters.hpp"
 #include "jdx/LdrContainer.hpp"
 #include "jdx/NTuples.hpp"
+#include "jdx/ParseOptions.hpp"
 #include "jdx/PeakAssignments.hpp"
 #include "jdx/PeakTable.hpp"
 #include "jdx/RaData.hpp"
@@ -31,9 +32,16 @@
 #include "jdx/XyData.hpp"
 #include "jdx/XyPoints.hpp"
 
+#include <istream>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace libjdx::jdx
@@ -49,8 +57,10 @@ public:
      * @param readerPtr Text reader with JCAMP-DX data. The reader position
      * is assumed to be at the start of the first line of the block (containing
      * the TITLE LDR).
+     * @param options Parse options.
      */
-    explicit Block(std::unique_ptr<io::TextReader> readerPtr);
+    explicit Block(std::unique_ptr<io::TextReader> readerPtr,
+        const ParseOptions& options = {});
 
     /**
      * @brief Constructs a Block from text reader data.
@@ -58,8 +68,9 @@ public:
      * is assumed to be at the start of the first line of the block (containing
      * the TITLE LDR). The reader is expected to exist for the lifetime of
      * this object.
+     * @param options Parse options.
      */
-    explicit Block(io::TextReader& reader);
+    explicit Block(io::TextReader& reader, const ParseOptions& options = {});
 
     /**
      * @brief Provides the labeled data records (LDRs) of the Block.
@@ -82,10 +93,29 @@ public:
      * label, e.g. "Title" and "TI TLE" will both find the "TITLE" LDR.
      * @return The LDR for the given label if it exists in the block,
      * std::nullopt otherwise.
+     *
+     * For lazily parsed blocks, LDRs preceding the first data record are
+     * parsed individually without parsing the whole block.
+     *
+     * @note The LDR is copied. Use findLdr() to avoid the copy.
      */
     [[nodiscard]] std::optional<const StringLdr> getLdr(
         const std::string& label) const;
 
+    /**
+     * @brief Looks up a labeled data record (LDR) in the block without
+     * copying it. The same exclusions as for getLdrs() apply.
+     * @param label The label of the LDR. Search will use normalized form of
+     * label, e.g. "Title" and "TI TLE" will both find the "TITLE" LDR.
+     * @return A pointer to the LDR for the given label if it exists in the
+     * block, nullptr otherwise. The LDR is owned by the block and remains
+     * valid for the lifetime of the block.
+     *
+     * For lazily parsed blocks, LDRs preceding the first data record are
+     * parsed individually without parsing the whole block.
+     */
+    [[nodiscard]] const StringLdr* findLdr(const std::string& label) const;
+
     /**
      * @brief Provides the nested Blocks of the Block.
      * @return Blocks that are nested in this (LINK) block.
@@ -160,22 +190,65 @@ public:
     getBrukerRelaxSections() const;
 
 private:
+    friend class JdxParser;
+
     static constexpr const char* s_blockStartLabel = "TITLE";
 
+    /**
+     * @brief The content of a block except for nested blocks.
+     */
+    struct Content
+    {
+        std::vector<StringLdr> ldrs;
+        // normalized label => position of the LDR in ldrs
+        std::unordered_map<std::string, size_t> ldrIndex;
+        std::vector<std::string> ldrComments;
+        std::optional<XyData> xyData;
+        std::optional<RaData> raData;
+        std::optional<XyPoints> xyPoints;
+        std::optional<PeakTable> peakTable;
+        std::optional<PeakAssignments> peakAssignments;
+        std::optional<NTuples> nTuples;
+        std::optional<AuditTrail> auditTrail;
+        std::vector<BrukerSpecificParameters> brukerSpecificParameters;
+        std::vector<BrukerRelaxSection> brukerRelaxSections;
+    };
+
+    /**
+     * @brief Synchronizes parsing a lazily parsed block on first access.
+     */
+    struct LazyParsing
+    {
+        std::once_flag contentParsed;
+        // keeps the reader the records of the content refer to alive
+        std::unique_ptr<io::TextReader> contentReader;
+        std::mutex indexedLdrsMutex;
+    };
+
     std::unique_ptr<io::TextReader> m_readerPtr;
     io::TextReader& m_reader;
-    std::vector<StringLdr> m_ldrs;
-    std::vector<std::string> m_ldrComments;
+    // holds the text of the LDRs of this block, freed in bulk with the block,
+    // declared before the content so that it outlives the content
+    std::unique_ptr<std::pmr::memory_resource> m_arena;
     std::vector<Block> m_blocks;
-    std::optional<XyData> m_xyData;
-    std::optional<RaData> m_raData;
-    std::optional<XyPoints> m_xyPoints;
-    std::optional<PeakTable> m_peakTable;
-    std::optional<PeakAssignments> m_peakAssignments;
-    std::optional<NTuples> m_nTuples;
-    std::optional<AuditTrail> m_auditTrail;
-    std::vector<BrukerSpecificParameters> m_brukerSpecificParameters;
-    std::vector<BrukerRelaxSection> m_brukerRelaxSections;
+    // empty for lazily parsed blocks until first accessed
+    mutable std::optional<Content> m_content;
+    // lazy parsing only
+    // null for eagerly parsed blocks
+    std::unique_ptr<LazyParsing> m_lazyParsing;
+    // position of the TITLE line
+    std::streampos m_titlePos;
+    // position of the line following the END line
+    std::streampos m_endPos;
+    // normalized labels and positions of LDRs preceding any data record
+    std::unordered_map<std::string, std::streampos> m_ldrIndex;
+    // normalized labels and LDRs parsed individually from the index, guarded
+    // by the mutex of m_lazyParsing
+    mutable std::unordered_map<std::string, StringLdr> m_indexedLdrs;
+    // false if LDRs other than those in the index may exist
+    bool m_isLdrIndexComplete;
+    // normalized labels and positions of the data records, e.g., XYDATA
+    std::unordered_map<std::string, std::streampos> m_dataIndex;
 
     /**
      * @brief Constructs a Block from first line value and reader.
@@ -191,11 +264,93 @@ private:
      */
     Block(const std::string& title, io::TextReader& reader,
         std::optional<std::string>& nextLine);
+
+    /**
+     * @brief Constructs a lazily parsed Block by scanning reader data.
+     * @param reader Text reader with JCAMP-DX data. The reader position
+     * is assumed to be at the start of the second line (the line following the
+     * TITLE line) of the block. The reader is expected to exist for the
+     * lifetime of this object. The reader position will be at the start of
+     * the line following the END line of the block.
+     * @param titlePos The position of the TITLE line.
+     */
+    Block(io::TextReader& reader, std::streampos titlePos);
+
+    /**
+     * @brief Constructs a Block from its own reader over data that has been
+     * scanned already.
+     * @param readerPtr Text reader with JCAMP-DX data.
+     * @param titlePos The position of the TITLE line.
+     * @param endPos The position of the line following the END line.
+     */
+    Block(std::unique_ptr<io::TextReader> readerPtr, std::streampos titlePos,
+        std::streampos endPos);
+
+    /**
+     * @brief Constructs a lazily parsed Block from a structural index written
+     * by writeIndex() instead of scanning the reader data.
+     * @param readerPtr Text reader with JCAMP-DX data.
+     * @param indexStream The index.
+     * @throws std::runtime_error If the index is malformed or does not fit the
+     * reader data.
+     */
+    Block(std::unique_ptr<io::TextReader> readerPtr, std::istream& indexStream);
+
+    /**
+     * @brief Constructs a lazily parsed nested Block from a structural index.
+     * @param reader Text reader with JCAMP-DX data. The reader is expected to
+     * exist for the lifetime of this object.
+     * @param indexStream The index positioned at the start of the block's
+     * entry.
+     * @throws std::runtime_error If the index is malformed or does not fit the
+     * reader data.
+     */
+    Block(io::TextReader& reader, std::istream& indexStream);
+
+    /**
+     * @brief Writes the structure of a lazily parsed Block, i.e., the
+     * boundaries of the block and its nested blocks and the LDR and data
+     * record offsets, to a structural index.
+     * @param indexStream The index to write to.
+     */
+    void writeIndex(std::ostream& indexStream) const;
+    void readIndex(std::istream& indexStream);
+
     static std::string parseFirstLine(const std::string& firstLine);
-    void parseInput(
-        const std::string& title, std::optional<std::string>& nextLine);
+    void parse(const std::string& titleValue, const ParseOptions& options);
+    void parseInParallel(const std::string& titleValue, size_t numThreads);
+    void scanInput();
+    [[nodiscard]] const Content& getContent() const;
+    [[nodiscard]] Content parseContent(io::TextReader& reader) const;
+    /**
+     * @brief Provides a data record of the content. Lazily parsed blocks are
+     * not parsed if the data index shows that the record does not exist.
+     * @param label The normalized label of the data record, e.g., "XYDATA".
+     * @param record The content member holding the record.
+     * @return The data record if available.
+     */
+    template<typename T>
+    [[nodiscard]] const std::optional<T>& getDataRecord(
+        const char* label, std::optional<T> Content::*record) const;
+    [[nodiscard]] StringLdr parseLdrAt(std::streampos pos) const;
+    /**
+     * @brief Parses the content of the block.
+     * @param titleValue The value of the first line of the block.
+     * @param reader The reader to parse from, positioned at the start of the
+     * second line of the block. Records of the content refer to it.
+     * @param nextLine Will contain the line following the END line of the
+     * block or nullopt if the end of the reader has been reached.
+     * @param content The content to fill.
+     * @param blocks The vector to add nested blocks to or nullptr if nested
+     * blocks have been scanned already and are to be skipped.
+     */
+    void parseInput(const std::string& titleValue, io::TextReader& reader,
+        std::optional<std::string>& nextLine, Content& content,
+        std::vector<Block>* blocks) const;
+    void addStringLdr(Content& content, std::string_view label,
+        std::string_view value) const;
     template<typename T>
-    void addLdr(const std::string& title, const std::string& label,
+    static void addLdr(const std::string& title, const std::string& label,
         std::optional<T>& member, const std::function<T()>& builderFunc);
 };
 
@@ -211,6 +366,18 @@ void libjdx::jdx::Block::addLdr(const std::string& title,
     }
     member.emplace(builderFunc());
 }
+
+template<typename T>
+const std::optional<T>& libjdx::jdx::Block::getDataRecord(
+    const char* label, std::optional<T> Content::*record) const
+{
+    if (m_lazyParsing != nullptr && m_dataIndex.count(label) == 0)
+    {
+        static const std::optional<T> noRecord;
+        return noRecord;
+    }
+    return getContent().*record;
+}
 } // namespace libjdx::jdx
 
 #endif // JDX_BLOCK_HPP
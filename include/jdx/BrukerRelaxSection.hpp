@@ -22,6 +22,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
@@ -64,12 +65,27 @@ public:
      */
     [[nodiscard]] std::string getName() const;
 
+    /**
+     * @brief Provides the name of the section without creating a new string.
+     * @return A view of the section name, valid for the lifetime of this
+     * object.
+     */
+    [[nodiscard]] std::string_view getNameView() const;
+
     /**
      * @brief Provides the contents of the section.
      * @return The section content.
      */
     [[nodiscard]] std::string getContent() const;
 
+    /**
+     * @brief Provides the contents of the section without creating a new
+     * string.
+     * @return A view of the section content, valid for the lifetime of this
+     * object.
+     */
+    [[nodiscard]] std::string_view getContentView() const;
+
 private:
     static constexpr const char* s_label = "$RELAX";
     static constexpr const char* s_labelFileNameStart = "$BRUKERFILE";
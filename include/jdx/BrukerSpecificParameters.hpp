@@ -22,8 +22,10 @@
 #include "jdx/LdrContainer.hpp"
 #include "jdx/StringLdr.hpp"
 
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
@@ -52,9 +54,12 @@ public:
      * @param nextLine The first line of the record, i.e., the one containing
      * the section start text. Will contain the line following the record or
      * nullopt if the end of the reader has been reached.
+     * @param resource The memory resource to allocate the text of the LDRs
+     * from. It must outlive this object.
      */
-    BrukerSpecificParameters(
-        io::TextReader& reader, std::optional<std::string>& nextLine);
+    BrukerSpecificParameters(io::TextReader& reader,
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief Provides the name of the section.
@@ -62,20 +67,36 @@ public:
      */
     [[nodiscard]] std::string getName() const;
 
+    /**
+     * @brief Provides the name of the section without creating a new string.
+     * @return A view of the section name, valid for the lifetime of this
+     * object.
+     */
+    [[nodiscard]] std::string_view getNameView() const;
+
     /**
      * @brief Provides the contents of the section as LDRs.
      * @return The section content.
      */
     [[nodiscard]] std::vector<StringLdr> getContent() const;
 
+    /**
+     * @brief Provides the contents of the section as LDRs without copying
+     * them.
+     * @return The section content, valid for the lifetime of this object.
+     */
+    [[nodiscard]] const std::vector<StringLdr>& getLdrs() const;
+
 private:
     static constexpr const char* s_sectionEndText
         = "$$ End of Bruker specific parameters";
 
-    void parse(io::TextReader& reader, std::optional<std::string>& nextLine);
+    void parse(io::TextReader& reader, std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource);
     static bool isDashedLine(std::optional<std::string>& nextLine);
-    void parseLdrs(
-        io::TextReader& reader, std::optional<std::string>& nextLine);
+    void parseLdrs(io::TextReader& reader,
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource);
 
     std::string m_name;
     std::vector<StringLdr> m_content;
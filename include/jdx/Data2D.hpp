@@ -20,7 +20,10 @@
 
 #include "io/TextReader.hpp"
 #include "jdx/DataLdr.hpp"
+#include "jdx/Spectrum.hpp"
 
+#include <functional>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
@@ -84,23 +87,21 @@ protected:
      * "X++(R..R)", or "X++(I..I)") from an XYDATA or RADATA block.
      * @param label The label of the first line of the record, i.e. "XYDATA" or
      * "RADATA".
-     * @param reader Text reader with JCAMP-DX data. The reader position is
-     * assumed to be at the start of the second line (the line following the
-     * line containing the label) of the record. The reader is expected to exist
-     * for the lifetime of this object.
      * @param firstX The first X value.
      * @param lastX The last X value.
      * @param yFactor The factor by which to multiply raw y values to arrive at
      * the actual value.
      * @param nPoints The number of xy pairs in this record.
-     * @return Pairs of xy data. Invalid values ("?") will be represented by
-     * std::numeric_limits<T>::quiet_NaN.
+     * @return The xy data with an implicit equidistant x axis. Invalid values
+     * ("?") will be represented by std::numeric_limits<T>::quiet_NaN.
      *
      * Note: XFACTOR is not required for parsing as the x values are determined
      * by FIRSTX, LASTX and NPOINTS.
+     *
+     * If the DecodeCache is enabled, the data is decoded only once. If
+     * ParallelDecoding is enabled, the data is decoded on multiple threads.
      */
-    std::vector<std::pair<double, double>> parseXppYYData(
-        const std::string& label, io::TextReader& reader, double firstX,
+    Spectrum parseXppYYData(std::string_view label, double firstX,
         double lastX, double yFactor, uint64_t nPoints) const;
 
     /**
@@ -108,21 +109,99 @@ protected:
      * "##XYDATA=" or "##RADATA=" block.
      * @param label The label of the first line of the record, i.e. "XYDATA" or
      * "RADATA".
-     * @param reader Text reader with JCAMP-DX data. The reader position is
-     * assumed to be at the start of the second line (the line following the
-     * line containing the label) of the record. The reader is expected to exist
-     * for the lifetime of this object.
      * @param xFactor The factor by which to multiply raw x values to arrive at
      * the actual value.
      * @param yFactor The factor by which to multiply raw y values to arrive at
      * the actual value.
      * @param nPoints The number of xy pairs in this record.
-     * @return Pairs of xy data. Invalid y values ("?") will be represented by
-     * std::numeric_limits<T>::quiet_NaN.
+     * @return The xy data with explicit x values. Invalid y values ("?") will
+     * be represented by std::numeric_limits<T>::quiet_NaN.
+     *
+     * If the DecodeCache is enabled, the data is decoded only once.
      */
-    std::vector<std::pair<double, double>> parseXyXyData(
-        const std::string& label, io::TextReader& reader, double xFactor,
+    Spectrum parseXyXyData(std::string_view label, double xFactor,
         double yFactor, std::optional<size_t> nPoints) const;
+
+    /**
+     * @brief Reads equally x spaced xy data (i.e. "X++(Y..Y)" and similar)
+     * from the current reader position without caching and without restoring
+     * the reader position.
+     * @param label The label of the first line of the record.
+     * @param reader Text reader positioned at the start of the data. Will be
+     * positioned at the start of the following LDR.
+     * @param firstX The first X value.
+     * @param lastX The last X value.
+     * @param yFactor The factor by which to multiply raw y values to arrive at
+     * the actual value.
+     * @param nPoints The number of xy pairs in this record.
+     * @return The xy data with an implicit equidistant x axis.
+     */
+    static Spectrum readXppYYSpectrum(std::string_view label,
+        io::TextReader& reader, double firstX, double lastX, double yFactor,
+        uint64_t nPoints);
+
+    /**
+     * @brief Reads xy data pairs (i.e. "(XY..XY)" and similar) from the
+     * current reader position without caching and without restoring the
+     * reader position.
+     * @param label The label of the first line of the record.
+     * @param reader Text reader positioned at the start of the data. Will be
+     * positioned at the start of the following LDR.
+     * @param xFactor The factor by which to multiply raw x values to arrive at
+     * the actual value.
+     * @param yFactor The factor by which to multiply raw y values to arrive at
+     * the actual value.
+     * @param nPoints The number of xy pairs in this record if known.
+     * @return The xy data with explicit x values.
+     */
+    static Spectrum readXyXySpectrum(std::string_view label,
+        io::TextReader& reader, double xFactor, double yFactor,
+        std::optional<size_t> nPoints);
+
+    /**
+     * @brief Decodes the equally x spaced xy data (i.e. "X++(Y..Y)" and
+     * similar) into caller provided buffers.
+     * @param label The label of the first line of the record.
+     * @param firstX The first X value.
+     * @param lastX The last X value.
+     * @param yFactor The factor by which to multiply raw y values to arrive at
+     * the actual value.
+     * @param nPoints The number of xy pairs in this record.
+     * @param x Buffer for the x values or nullptr if not required.
+     * @param y Buffer for the y values.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written, i.e., nPoints.
+     * @throws std::invalid_argument If the buffers cannot hold nPoints values.
+     */
+    size_t decodeXppYYData(std::string_view label, double firstX,
+        double lastX, double yFactor, uint64_t nPoints, double* x, double* y,
+        size_t size) const;
+
+    /**
+     * @brief Decodes the xy data pairs (i.e. "(XY..XY)" and similar) into
+     * caller provided buffers.
+     * @param label The label of the first line of the record.
+     * @param xFactor The factor by which to multiply raw x values to arrive at
+     * the actual value.
+     * @param yFactor The factor by which to multiply raw y values to arrive at
+     * the actual value.
+     * @param nPoints The number of xy pairs in this record if known.
+     * @param x Buffer for the x values or nullptr if not required.
+     * @param y Buffer for the y values.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written.
+     * @throws std::invalid_argument If the buffers cannot hold nPoints values.
+     */
+    size_t decodeXyXyData(std::string_view label, double xFactor,
+        double yFactor, std::optional<size_t> nPoints, double* x, double* y,
+        size_t size) const;
+
+private:
+    Spectrum getCachedSpectrum(const std::function<Spectrum()>& decode) const;
+    static void checkBufferSize(std::string_view label,
+        const double* y, size_t size, std::optional<uint64_t> nPoints);
+    static void checkNumPoints(
+        std::string_view label, uint64_t nPoints, size_t actual);
 };
 } // namespace libjdx::jdx
 
@@ -21,15 +21,25 @@
 #include "io/TextReader.hpp"
 #include "jdx/Ldr.hpp"
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
 {
 /**
  * @brief Base class for JCAMP-DX data records.
+ *
+ * The data is decoded on access through a separate cursor over the reader's
+ * data if the reader supports cursors. Accessing the data of records sharing a
+ * reader is then thread-safe. The record then also shares ownership of the
+ * data, so that copies of the record can still access it after the reader
+ * (and the Block owning it) is gone. Otherwise, the reader must outlive the
+ * record.
  */
 class DataLdr : public Ldr
 {
@@ -45,6 +55,21 @@ protected:
         std::string label, std::string variableList, io::TextReader& reader);
 
     [[nodiscard]] io::TextReader& getReader() const;
+
+    /**
+     * @brief The position of the record's data in the reader.
+     * @return The position of the line following the record's label.
+     */
+    [[nodiscard]] std::streampos getDataPos() const;
+
+    /**
+     * @brief The key identifying this record's decoded data in the
+     * DecodeCache. Copies of a record share the same key. Cached data is
+     * removed when the last copy is destroyed.
+     * @return The cache key.
+     */
+    [[nodiscard]] uint64_t getCacheKey() const;
+
     /**
      * @brief Validates if input is a valid data LDR.
      * @param label LDR label.
@@ -53,23 +78,48 @@ protected:
      * @param expectedVariableList The expected variable list.
      * @throws If label or variable list don't match expectations.
      */
-    static void validateInput(const std::string& label,
+    static void validateInput(std::string_view label,
         const std::string& variableList, const std::string& expectedLabel,
         const std::vector<std::string>& expectedVariableLists);
 
+    /**
+     * @brief Calls a function with a reader positioned at the start of the
+     * record's data.
+     *
+     * If the reader supports cursors, the function is passed a new cursor over
+     * the same data so that the reader's position remains untouched and
+     * concurrent calls, also for other records sharing the reader, are safe.
+     * Otherwise, the function is passed the reader itself, whose position is
+     * reset afterwards.
+     *
+     * @param func The function to call.
+     * @return The function's return value.
+     */
     template<typename R>
-    R callAndResetStreamPos(const std::function<R()>& func) const;
+    R readData(const std::function<R(io::TextReader&)>& func) const;
 
 private:
     const std::string m_variableList;
     io::TextReader& m_reader;
+    // only used for creating cursors, keeps the data alive
+    std::shared_ptr<const io::TextReader> m_source;
     std::streampos m_dataPos;
+    std::shared_ptr<const uint64_t> m_cacheKey;
+
+    static std::shared_ptr<const uint64_t> createCacheKey();
 };
 
 template<typename R>
-R libjdx::jdx::DataLdr::callAndResetStreamPos(
-    const std::function<R()>& func) const
+R libjdx::jdx::DataLdr::readData(
+    const std::function<R(io::TextReader&)>& func) const
 {
+    if (m_source != nullptr)
+    {
+        auto cursor = m_source->createCursor();
+        cursor->seekg(m_dataPos);
+        return func(*cursor);
+    }
+
     auto pos = m_reader.eof() ? std::nullopt
                               : std::optional<std::streampos>(m_reader.tellg());
     auto resetPosition = [pos, this] {
@@ -86,7 +136,7 @@ R libjdx::jdx::DataLdr::callAndResetStreamPos(
     try
     {
         m_reader.seekg(m_dataPos);
-        R returnValue = func();
+        R returnValue = func(m_reader);
         resetPosition();
         return returnValue;
     }
@@ -22,11 +22,13 @@
 #include "jdx/Data2D.hpp"
 #include "jdx/NTuplesAttributes.hpp"
 #include "jdx/ParseException.hpp"
+#include "jdx/Spectrum.hpp"
 
 #include <array>
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
@@ -57,13 +59,15 @@ public:
      * @param nextLine The first line of the LDR, i.e. the one containing the
      * label. Will contain the line following the record or nullopt if the end
      * of the reader has been reached.
+     * @param skipData If false, the reader is left at the start of the data
+     * and nextLine is not updated, e.g., for reading the data right away.
      */
     DataTable(std::string label, std::string variableList,
         std::optional<std::string> plotDescriptor,
         const std::vector<StringLdr>& blockLdrs,
         const std::vector<NTuplesAttributes>& nTuplesAttributes,
         const std::vector<StringLdr>& pageLdrs, io::TextReader& reader,
-        std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine, bool skipData = true);
 
     /**
      * @brief The plot descriptor of the data table, e.g., "XYDATA" for
@@ -85,6 +89,68 @@ public:
      */
     [[nodiscard]] std::vector<std::pair<double, double>> getData() const;
 
+    /**
+     * @brief The (already scaled if applicable) data from the DATA TABLE in
+     * columnar form.
+     * @return The data from the data table.
+     */
+    [[nodiscard]] Spectrum getSpectrum() const;
+
+    /**
+     * @brief Decodes the (already scaled if applicable) data from the DATA
+     * TABLE into caller provided buffers without intermediate copies of the
+     * data.
+     * @param x Buffer for at least VAR_DIM x values or nullptr if x values are
+     * not required.
+     * @param y Buffer for at least VAR_DIM y values.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written.
+     * @throws std::invalid_argument If the buffers are too small for VAR_DIM
+     * values or, without VAR_DIM, for the actual number of points.
+     * @throws ParseException If the data is malformed or the number of points
+     * does not match VAR_DIM.
+     */
+    size_t decodeInto(double* x, double* y, size_t size) const;
+
+    /**
+     * @brief Reads the (already scaled if applicable) data from the DATA TABLE
+     * without restoring the reader position, e.g., for reading the DATA
+     * TABLEs of an NTUPLES record in a single forward pass. The DecodeCache
+     * is not used.
+     * @param reader A reader over the same data as the record's reader. Will
+     * be positioned at the start of the LDR following the data.
+     * @return The data from the data table.
+     * @throws ParseException If the data is malformed or the number of points
+     * does not match VAR_DIM.
+     */
+    [[nodiscard]] Spectrum readSpectrum(io::TextReader& reader) const;
+
+    /**
+     * @brief Whether the x values are equidistant and implied by the
+     * attributes, e.g., for "(X++(R..R))", rather than stored with the data.
+     * @return True for equidistant x values, false otherwise.
+     */
+    [[nodiscard]] bool hasImplicitX() const;
+
+    /**
+     * @brief Validates the first line of a DATA TABLE record without parsing
+     * the record.
+     * @param variableList The variable list, e.g. "(X++(Y..Y))".
+     * @param plotDescriptor The plot descriptor, e.g. "XYDATA".
+     * @throws ParseException If the variable list or plot descriptor is
+     * illegal.
+     */
+    static void validateStart(const std::string& variableList,
+        const std::optional<std::string>& plotDescriptor);
+
+    /**
+     * @brief Whether an LDR of the surrounding block is used for determining
+     * the attributes of a DATA TABLE.
+     * @param label The normalized label of the LDR.
+     * @return True if the LDR is used, false otherwise.
+     */
+    static bool isMergedBlockLdr(std::string_view label);
+
 private:
     enum class PlotDescriptor
     {
@@ -118,6 +184,35 @@ private:
             {"CONTOUR", PlotDescriptor::Contour}}};
     static constexpr std::array<const char*, 3> s_xSymbols = {"X", "T2", "F2"};
     static constexpr std::array<const char*, 3> s_ySymbols = {"Y", "R", "I"};
+    template<typename T>
+    using AttributeMapping
+        = std::pair<const char*, std::optional<T> NTuplesAttributes::*>;
+    /**
+     * @brief Block and page LDRs merged into the attributes of an abscissa or
+     * ordinate variable.
+     */
+    struct MergedLdrMapping
+    {
+        AttributeMapping<std::string> units;
+        std::array<AttributeMapping<double>, 5> doubles;
+        AttributeMapping<uint64_t> varDim;
+    };
+    static constexpr MergedLdrMapping s_xMergedLdrMapping
+        = {{"XUNITS", &NTuplesAttributes::units},
+            {{{"FIRSTX", &NTuplesAttributes::first},
+                {"LASTX", &NTuplesAttributes::last},
+                {"MINX", &NTuplesAttributes::min},
+                {"MAXX", &NTuplesAttributes::max},
+                {"XFACTOR", &NTuplesAttributes::factor}}},
+            {"NPOINTS", &NTuplesAttributes::varDim}};
+    static constexpr MergedLdrMapping s_yMergedLdrMapping
+        = {{"YUNITS", &NTuplesAttributes::units},
+            {{{"FIRSTY", &NTuplesAttributes::first},
+                {"LASTY", &NTuplesAttributes::last},
+                {"MINY", &NTuplesAttributes::min},
+                {"MAXY", &NTuplesAttributes::max},
+                {"YFACTOR", &NTuplesAttributes::factor}}},
+            {"NPOINTS", &NTuplesAttributes::varDim}};
 
     const std::optional<std::string> m_plotDescriptor;
     Attributes m_mergedAttributes;
@@ -125,7 +220,7 @@ private:
     void parse(const std::vector<StringLdr>& blockLdrs,
         const std::vector<NTuplesAttributes>& nTuplesVars,
         const std::vector<StringLdr>& pageLdrs,
-        std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine, bool skipData);
     std::pair<VariableList, std::optional<PlotDescriptor>> parseDataTableVars();
     static VariableList determineVariableList(const std::string& varList);
     static PlotDescriptor determinePlotDescriptor(
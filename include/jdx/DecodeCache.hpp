@@ -0,0 +1,138 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_DECODECACHE_HPP
+#define JDX_DECODECACHE_HPP
+
+#include "jdx/Spectrum.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace libjdx::jdx
+{
+/**
+ * @brief Library wide least recently used (LRU) cache for decoded data.
+ *
+ * Decoding the data of a data LDR is expensive. When the cache is enabled,
+ * the decoded data of each data LDR is kept in memory and subsequent reads of
+ * the same data are served from the cache. Decoded data is immutable and
+ * shared between the cache and all callers, so cache hits do not copy the
+ * data.
+ *
+ * The cache is disabled by default (memory budget of zero bytes). It is
+ * enabled by setting a memory budget. If the memory used by the cached data
+ * exceeds the budget, the least recently used data is evicted. Data larger
+ * than the budget is never cached.
+ *
+ * All methods are thread safe.
+ */
+class DecodeCache
+{
+public:
+    DecodeCache(const DecodeCache&) = delete;
+    DecodeCache& operator=(const DecodeCache&) = delete;
+    DecodeCache(DecodeCache&&) = delete;
+    DecodeCache& operator=(DecodeCache&&) = delete;
+    ~DecodeCache() = default;
+
+    /**
+     * @brief The library wide cache instance.
+     * @return The cache instance.
+     */
+    static DecodeCache& getInstance();
+
+    /**
+     * @brief Sets the memory budget. Evicts cached data as required to meet
+     * the new budget.
+     * @param bytes The maximum number of bytes of decoded data to be held. Zero
+     * disables the cache.
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief The memory budget.
+     * @return The maximum number of bytes of decoded data to be held.
+     */
+    [[nodiscard]] size_t getMemoryBudget() const;
+
+    /**
+     * @brief The memory currently used by cached data.
+     * @return The number of bytes of decoded data held.
+     */
+    [[nodiscard]] size_t getMemoryUsage() const;
+
+    /**
+     * @brief Removes all cached data.
+     */
+    void clear();
+
+    /**
+     * @brief Looks up cached data and marks it as most recently used.
+     * @param key The key of the data LDR.
+     * @return The cached data if present.
+     */
+    std::optional<Spectrum> find(uint64_t key);
+
+    /**
+     * @brief Caches data, replacing any data cached for the same key. Does
+     * nothing if the data does not fit into the memory budget.
+     * @param key The key of the data LDR.
+     * @param spectrum The decoded data.
+     */
+    void insert(uint64_t key, const Spectrum& spectrum);
+
+    /**
+     * @brief Removes cached data.
+     * @param key The key of the data LDR.
+     */
+    void erase(uint64_t key);
+
+    /**
+     * @brief Creates a key that is unique for the lifetime of the process.
+     * @return A new key.
+     */
+    static uint64_t createKey();
+
+private:
+    struct Entry
+    {
+        Spectrum spectrum;
+        size_t size;
+        std::list<uint64_t>::iterator lruPos;
+    };
+
+    mutable std::mutex m_mutex;
+    size_t m_memoryBudget;
+    size_t m_memoryUsage;
+    // most recently used first
+    std::list<uint64_t> m_lru;
+    std::unordered_map<uint64_t, Entry> m_entries;
+
+    DecodeCache();
+
+    static size_t getSize(const Spectrum& spectrum);
+    void eraseEntry(std::unordered_map<uint64_t, Entry>::iterator it);
+    void evict(size_t budget);
+};
+} // namespace libjdx::jdx
+
+#endif // JDX_DECODECACHE_HPP
@@ -19,10 +19,14 @@
 #define JDX_JDXPARSER_HPP
 
 #include "jdx/Block.hpp"
+#include "jdx/ParseOptions.hpp"
 
+#include <array>
+#include <cstdint>
 #include <istream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace libjdx::jdx
 {
@@ -44,21 +48,75 @@ public:
     /**
      * @brief Parses the data.
      * @param stream Binary input stream for the data.
+     * @param options Parse options.
      * @return A Block representing the data.
      */
-    Block static parse(std::unique_ptr<std::istream> streamPtr);
+    Block static parse(std::unique_ptr<std::istream> streamPtr,
+        const ParseOptions& options = {});
 
     /**
      * @brief Parses the data.
      * @param filePath Path to the file.
+     * @param options Parse options.
      * @return A Block representing the data.
      */
-    Block static parse(const std::string& filePath);
+    Block static parse(
+        const std::string& filePath, const ParseOptions& options = {});
+
+    /**
+     * @brief Parses data held in memory without copying it.
+     * @param buffer The data. It is kept alive by the returned Block and must
+     * not be modified while the Block exists.
+     * @param options Parse options. The reader type is ignored as the data is
+     * always read directly from memory.
+     * @return A Block representing the data.
+     * @throws std::invalid_argument If the buffer is null.
+     */
+    Block static parse(std::shared_ptr<const std::vector<char>> buffer,
+        const ParseOptions& options = {});
+
+    /**
+     * @brief Parses data held in memory. The data is copied once so that the
+     * returned Block does not depend on the lifetime of the input.
+     * @param data Pointer to the first char of the data.
+     * @param size The number of chars.
+     * @param options Parse options. The reader type is ignored as the data is
+     * always read directly from memory.
+     * @return A Block representing the data.
+     */
+    Block static parse(
+        const char* data, size_t size, const ParseOptions& options = {});
 
 private:
     static constexpr std::array<const char*, 3> s_acceptedExtensions
         = {".jdx", ".dx", ".jcm"};
     static constexpr size_t s_scanBufferSize = 16;
+    static constexpr const char* s_indexFileExtension = ".idx";
+    static constexpr const char* s_indexFileMagic = "libjdx-index";
+    static constexpr int s_indexFileVersion = 2;
+    static constexpr uintmax_t s_networkMappedMaxSize = 16 * 1024 * 1024;
+    static constexpr size_t s_networkBufferSize = 64 * 1024;
+    // filesystem type magic numbers as reported by statfs()
+    static constexpr std::array<uint32_t, 9> s_networkFileSystemTypes = {
+        0x6969, // NFS
+        0x517B, // SMB
+        0xFF534D42, // CIFS
+        0xFE534D42, // SMB2
+        0x5346414F, // AFS
+        0x73757245, // CODA
+        0x564C, // NCP
+        0x00C36400, // CEPH
+        0x01021997, // 9P
+    };
+
+    static Block parseWithIndexFile(
+        const std::string& filePath, const ParseOptions& options);
+    static std::string getFileStamp(const std::string& filePath);
+    static std::unique_ptr<io::TextReader> createTextReader(
+        std::unique_ptr<std::istream> streamPtr, io::TextReaderType type);
+    static std::unique_ptr<io::TextReader> createTextReader(
+        const std::string& filePath, io::TextReaderType type);
+    static bool isNetworkFileSystem(const std::string& filePath);
 };
 } // namespace libjdx::jdx
 
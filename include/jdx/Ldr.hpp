@@ -18,7 +18,9 @@
 #ifndef JDX_LDR_HPP
 #define JDX_LDR_HPP
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 namespace libjdx::jdx
 {
@@ -29,16 +31,28 @@ class Ldr
 {
 public:
     /**
-     * @brief Constructs a Ldr from label and string value.
+     * @brief Constructs a Ldr from label.
      * @param label The label of the LDR, e.g. "TITLE" for "##TITLE= abc".
+     * @param resource The memory resource to allocate the label text from,
+     * e.g., the arena of the containing Block. It must outlive the Ldr.
+     * Copies of the Ldr use the default resource.
      */
-    explicit Ldr(std::string label);
+    explicit Ldr(std::string_view label,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief The label of the LDR, e.g. "TITLE" for "##TITLE= abc".
-     * @return The label of the LDR.
+     * @return A copy of the label of the LDR.
+     * @deprecated Use getLabelView(), which does not copy the label.
      */
-    [[nodiscard]] const std::string& getLabel() const;
+    [[nodiscard, deprecated("Use getLabelView() instead.")]] std::string
+    getLabel() const;
+
+    /**
+     * @brief The label of the LDR, e.g. "TITLE" for "##TITLE= abc".
+     * @return A view of the label, valid for the lifetime of this object.
+     */
+    [[nodiscard]] std::string_view getLabelView() const;
 
     /**
      * @brief Whether LDR is user defined, i.e. the label starts
@@ -55,7 +69,7 @@ public:
     [[nodiscard]] bool isTechniqueSpecific() const;
 
 private:
-    const std::string m_label;
+    std::pmr::string m_label;
 };
 } // namespace libjdx::jdx
 
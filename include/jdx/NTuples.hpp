@@ -25,7 +25,13 @@
 #include "jdx/StringLdr.hpp"
 
 #include <functional>
+#include <ios>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx
@@ -36,6 +42,45 @@ namespace libjdx::jdx
 class NTuples : public LdrContainer
 {
 public:
+    /**
+     * @brief The y values of all PAGEs as a dense matrix with one row per
+     * PAGE and a shared equidistant x axis.
+     */
+    struct Matrix
+    {
+        /**
+         * @brief The number of rows, i.e., PAGEs.
+         */
+        size_t rows = 0;
+        /**
+         * @brief The number of columns, i.e., points per PAGE.
+         */
+        size_t cols = 0;
+        /**
+         * @brief The y values in row-major order, i.e., the value of a row and
+         * column is at index row * cols + col. Invalid values ("?") are
+         * represented by std::numeric_limits<double>::quiet_NaN.
+         */
+        std::vector<double> values;
+        /**
+         * @brief The x value of the first column.
+         */
+        double firstX = 0.0;
+        /**
+         * @brief The x value of the last column.
+         */
+        double lastX = 0.0;
+        /**
+         * @brief The DATA TABLE attributes of the first PAGE. The x attributes
+         * apply to all rows.
+         */
+        DataTable::Attributes attributes;
+        /**
+         * @brief The PAGE variables of each row, e.g., "N=1".
+         */
+        std::vector<std::string> pageVariables;
+    };
+
     /**
      * @brief Constructs the record.
      * @param label The label of the LDR, "NTUPLES".
@@ -47,10 +92,14 @@ public:
      * @param nextLine The first line of the LDR, i.e. the one containing the
      * label. Will contain the line following the record or nullopt if the end
      * of the reader has been reached.
+     * @param resource The memory resource to allocate the text of the LDRs
+     * from, including those of pages parsed on demand. It must outlive this
+     * object.
      */
     NTuples(const std::string& label, std::string dataForm,
         const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-        std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief The data form of the NTUPLES record (value of the
@@ -59,6 +108,13 @@ public:
      */
     [[nodiscard]] std::string getDataForm() const;
 
+    /**
+     * @brief The data form of the NTUPLES record without creating a new
+     * string.
+     * @return A view of the data form, valid for the lifetime of this object.
+     */
+    [[nodiscard]] std::string_view getDataFormView() const;
+
     /**
      * @brief Returns the LDRs excluding PAGEs.
      * @return The LDRs in this record.
@@ -81,27 +137,89 @@ public:
      * @brief Retrieves a page from the record.
      * @param pageIndex The page index starting at zero.
      * @return The page.
+     *
+     * @note Pages are parsed on first access. This is thread-safe if the
+     * reader supports cursors, otherwise the shared reader is moved.
+     * @throws ParseException If the page content is malformed.
      */
     [[nodiscard]] const Page& getPage(size_t pageIndex) const;
 
+    /**
+     * @brief Decodes the DATA TABLEs of all pages into a single matrix.
+     * @param numThreads The maximum number of threads used for decoding the
+     * pages. 1 (default) decodes sequentially, 0 uses one thread per hardware
+     * thread. Ignored if the reader does not support cursors.
+     * @return The matrix.
+     *
+     * @note Pages not yet parsed are parsed first, see getPage().
+     * @throws ParseException If a page has no DATA TABLE, the DATA TABLEs do
+     * not share the same equidistant x axis, or the data is malformed.
+     */
+    [[nodiscard]] Matrix decodeMatrix(size_t numThreads = 1) const;
+
+    /**
+     * @brief Decodes the DATA TABLEs of all pages in file order in a single
+     * forward pass over the data, i.e., without seeking back and forth
+     * between pages.
+     * @param consume Called for each page with the page index, the page, and
+     * its data. The data is empty for pages without DATA TABLE.
+     *
+     * @note Pages not yet parsed are parsed in the same pass, see getPage().
+     * The DecodeCache is not used.
+     * @throws ParseException If the data is malformed.
+     */
+    void decodePages(const std::function<void(size_t, const Page&,
+            const Spectrum&)>& consume) const;
+
 private:
     static constexpr const char* s_label = "NTUPLES";
     static constexpr std::array<const char*, 11> s_standardAttrNames
         = {"VARNAME", "SYMBOL", "VARTYPE", "VARFORM", "VARDIM", "UNITS",
             "FIRST", "LAST", "MIN", "MAX", "FACTOR"};
 
+    /**
+     * @brief The location of a PAGE in the reader.
+     */
+    struct PageOffset
+    {
+        /**
+         * @brief The position of the line following the PAGE label.
+         */
+        std::streampos position;
+
+        /**
+         * @brief The PAGE variables, e.g., "N=1".
+         */
+        std::string pageVariables;
+    };
+
+    io::TextReader& m_reader;
+    std::pmr::memory_resource* m_resource;
     const std::string m_dataForm;
     std::vector<StringLdr> m_ldrs;
+    std::vector<StringLdr> m_blockLdrs;
     std::vector<NTuplesAttributes> m_attributes;
-    std::vector<Page> m_pages;
+    std::vector<PageOffset> m_pageOffsets;
+    // empty until first accessed, a page once set is never modified
+    mutable std::vector<std::optional<Page>> m_pages;
+    // guards m_pages, held by pointer to keep the record movable
+    std::unique_ptr<std::mutex> m_pagesMutex;
 
     static void validateInput(const std::string& label);
+    static std::optional<std::string> scanPage(io::TextReader& reader);
+    [[nodiscard]] const Page* findPage(size_t pageIndex) const;
+    const Page& publishPage(size_t pageIndex, Page page) const;
+    [[nodiscard]] Page parsePage(
+        io::TextReader& reader, size_t pageIndex, bool skipData = true) const;
     void parse(const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-        std::optional<std::string>& nextLine);
-    std::vector<NTuplesAttributes> parseAttributes(
-        io::TextReader& reader, std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource);
+    std::vector<NTuplesAttributes> parseAttributes(io::TextReader& reader,
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource);
     static std::vector<StringLdr> readLdrs(
-        std::optional<std::string>& firstLdrStart, io::TextReader& reader);
+        std::optional<std::string>& firstLdrStart, io::TextReader& reader,
+        std::pmr::memory_resource* resource);
     static std::map<std::string, std::vector<std::string>> splitValues(
         const std::vector<StringLdr>& ldr);
     static std::map<std::string, std::vector<std::string>>
@@ -27,6 +27,7 @@
 #include <array>
 #include <functional>
 #include <map>
+#include <memory_resource>
 #include <vector>
 
 namespace libjdx::jdx
@@ -49,11 +50,18 @@ public:
      * @param nextLine The first line of the LDR, i.e. the one containing the
      * label. Will contain the line following the record or nullopt if the end
      * of the reader has been reached.
+     * @param resource The memory resource to allocate the text of the LDRs
+     * from. It must outlive this object.
+     * @param skipData If false and the page contains a DATA TABLE, the reader
+     * is left at the start of the data and nextLine is not updated, e.g., for
+     * reading the data right away.
      */
     Page(std::string& label, std::string pageVar,
         const std::vector<NTuplesAttributes>& nTuplesAttributes,
         const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-        std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+        bool skipData = true);
 
     /**
      * @brief The page variables of the PAGE record (value of
@@ -75,6 +83,16 @@ public:
      */
     [[nodiscard]] const std::optional<DataTable>& getDataTable() const;
 
+    /**
+     * @brief Validates the first line of a DATA TABLE inside a PAGE without
+     * parsing the PAGE.
+     * @param rawPageVars The value of the DATA TABLE LDR start, e.g.,
+     * "(X++(R..R)), XYDATA".
+     * @throws ParseException If the variable list or plot descriptor is
+     * illegal.
+     */
+    static void validateDataTableStart(const std::string& rawPageVars);
+
 private:
     static constexpr const char* s_label = "PAGE";
 
@@ -85,11 +103,15 @@ private:
     static void validateInput(const std::string& label);
     void parse(const std::vector<NTuplesAttributes>& nTuplesAttributes,
         const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-        std::optional<std::string>& nextLine);
-    static std::vector<StringLdr> parsePageLdrs(
-        io::TextReader& reader, std::optional<std::string>& nextLine);
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource, bool skipData);
+    static std::vector<StringLdr> parsePageLdrs(io::TextReader& reader,
+        std::optional<std::string>& nextLine,
+        std::pmr::memory_resource* resource);
     static std::pair<std::string, std::optional<std::string>>
     parseDataTableVars(const std::string& rawPageVars);
+    static std::vector<std::string> splitDataTableVars(
+        const std::string& pageVars);
 };
 } // namespace libjdx::jdx
 
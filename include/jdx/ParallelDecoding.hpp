@@ -0,0 +1,59 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_PARALLELDECODING_HPP
+#define JDX_PARALLELDECODING_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace libjdx::jdx
+{
+/**
+ * @brief Library wide settings for decoding data on multiple threads.
+ *
+ * Decoding is sequential by default. When enabled, large (X++(Y..Y)) data
+ * sections, e.g., of XYDATA records, are split into line aligned chunks that
+ * are decoded in parallel. The results are identical to sequential decoding.
+ *
+ * All methods are thread safe.
+ */
+class ParallelDecoding
+{
+public:
+    /**
+     * @brief Sets the maximum number of threads used for decoding a single
+     * data record.
+     * @param numThreads The maximum number of threads. 1 (default) decodes
+     * sequentially, 0 uses one thread per hardware thread.
+     */
+    static void setNumThreads(size_t numThreads);
+
+    /**
+     * @brief The maximum number of threads used for decoding a single data
+     * record.
+     * @return The maximum number of threads. 1 for sequential decoding, 0 for
+     * one thread per hardware thread.
+     */
+    [[nodiscard]] static size_t getNumThreads();
+
+private:
+    static std::atomic<size_t> s_numThreads;
+};
+} // namespace libjdx::jdx
+
+#endif // JDX_PARALLELDECODING_HPP
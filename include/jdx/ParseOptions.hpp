@@ -0,0 +1,90 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_PARSEOPTIONS_HPP
+#define JDX_PARSEOPTIONS_HPP
+
+#include "io/TextReader.hpp"
+
+#include <cstddef>
+
+namespace libjdx::jdx
+{
+/**
+ * @brief Options for parsing JCAMP-DX data.
+ */
+struct ParseOptions
+{
+    /**
+     * @brief Parse blocks lazily.
+     *
+     * If true, opening the data only scans it once for the boundaries of
+     * nested blocks and the offsets of the LDRs preceding the first data
+     * record of each block. The LDRs and data records of a block are parsed
+     * when first accessed. Errors in the content of a block are then only
+     * reported when the block is accessed.
+     *
+     * Parsing on first access is thread-safe if the reader supports cursors
+     * (the default for native builds), as each block is then parsed once
+     * through its own cursor. Otherwise, parsing moves the shared reader,
+     * hence lazy blocks of the same data must not be accessed concurrently.
+     */
+    bool lazy = false;
+
+    /**
+     * @brief The maximum number of threads used for parsing nested blocks.
+     *
+     * 1 (default) parses sequentially, 0 uses one thread per hardware thread.
+     * Otherwise, the boundaries of nested blocks are determined first, then
+     * the nested blocks are parsed in parallel, each with its own reader
+     * over the same data. The result is identical to sequential parsing.
+     * Ignored for lazy parsing, for WebAssembly builds, and for readers that
+     * do not support cursors.
+     */
+    size_t numThreads = 1;
+
+    /**
+     * @brief Use a structural index file for lazily parsing a file.
+     *
+     * If true and lazy is true, parsing a file at "path" reads the boundaries
+     * of blocks and the LDR and data record offsets from the index file
+     * "path.idx" instead of scanning the data. If the index file does not
+     * exist or does not match the file's size and modification time, the data
+     * is scanned and the index file is (re)written. Failures to write the
+     * index file are ignored. Has no effect when parsing streams.
+     */
+    bool useIndexFile = false;
+
+    /**
+     * @brief The reader implementation used for reading the data.
+     *
+     * Auto (default) uses BufferedTextReader for WebAssembly builds. Otherwise,
+     * files are memory mapped with MappedTextReader unless they are large and
+     * reside on a network file system, in which case BufferedTextReader with
+     * read-ahead is used, or on a FUSE file system, in which case
+     * BufferedTextReader is used. Streams and files that can not be mapped
+     * (e.g., pipes, virtual files) are read completely into memory.
+     *
+     * @note A memory mapped file that is truncated by another process while
+     * being read may terminate the process with SIGBUS. Choose Buffered for
+     * files that may be modified during parsing.
+     */
+    io::TextReaderType readerType = io::TextReaderType::Auto;
+};
+} // namespace libjdx::jdx
+
+#endif // JDX_PARSEOPTIONS_HPP
@@ -21,6 +21,7 @@
 #include "io/TextReader.hpp"
 #include "jdx/Data2D.hpp"
 #include "jdx/RaParameters.hpp"
+#include "jdx/Spectrum.hpp"
 #include "jdx/StringLdr.hpp"
 
 #include <string>
@@ -65,6 +66,29 @@ public:
      */
     std::vector<std::pair<double, double>> getData();
 
+    /**
+     * @brief Provides the parsed xy data in columnar form.
+     * @return The xy data. Invalid values ("?") will be represented by
+     * std::numeric_limits<double>::quiet_NaN.
+     */
+    [[nodiscard]] Spectrum getSpectrum() const;
+
+    /**
+     * @brief Decodes the xy data into caller provided buffers without
+     * intermediate copies of the data.
+     * @param x Buffer for at least NPOINTS x values or nullptr if x values are
+     * not required.
+     * @param y Buffer for at least NPOINTS y values. Invalid values ("?") will
+     * be represented by std::numeric_limits<double>::quiet_NaN.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written.
+     * @throws std::invalid_argument If the buffers are too small for NPOINTS
+     * values.
+     * @throws ParseException If the data is malformed or the number of points
+     * does not match NPOINTS.
+     */
+    size_t decodeInto(double* x, double* y, size_t size) const;
+
 private:
     static constexpr const char* s_raDataLabel = "RADATA";
     static constexpr const char* s_raDataVariableList = "(R++(A..A))";
@@ -0,0 +1,154 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_SPECTRUM_HPP
+#define JDX_SPECTRUM_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace libjdx::jdx
+{
+/**
+ * @brief Columnar 2D data, i.e., separate contiguous arrays for x and y values.
+ *
+ * For equidistant data, e.g., (X++(Y..Y)), the x values are not stored but
+ * computed from the first and last x value and the number of points.
+ *
+ * The values are immutable and shared between copies, so copying a spectrum
+ * is cheap.
+ */
+class Spectrum
+{
+public:
+    /**
+     * @brief Constructs an empty spectrum.
+     */
+    Spectrum();
+
+    /**
+     * @brief Constructs a spectrum with an implicit equidistant x axis.
+     * @param firstX The x value of the first point.
+     * @param lastX The x value of the last point.
+     * @param yValues The y values.
+     */
+    Spectrum(double firstX, double lastX, std::vector<double> yValues);
+
+    /**
+     * @brief Constructs a spectrum with explicit x values.
+     * @param xValues The x values.
+     * @param yValues The y values.
+     * @throws std::invalid_argument If the numbers of x and y values differ.
+     */
+    Spectrum(std::vector<double> xValues, std::vector<double> yValues);
+
+    /**
+     * @brief The distance between two neighboring x values of an equidistant
+     * x axis.
+     * @param firstX The x value of the first point.
+     * @param lastX The x value of the last point.
+     * @param nPoints The number of points.
+     * @return The x increment.
+     */
+    static double computeXIncrement(
+        double firstX, double lastX, size_t nPoints);
+
+    /**
+     * @brief The number of points.
+     * @return The number of points.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Whether the spectrum contains no points.
+     * @return True if there are no points, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Whether the x axis is equidistant and its values are computed.
+     * @return True if x values are not stored, false otherwise.
+     */
+    [[nodiscard]] bool hasImplicitX() const;
+
+    /**
+     * @brief The x value of the first point of an implicit x axis.
+     * @return The first x value. Undefined for explicit x values.
+     */
+    [[nodiscard]] double getFirstX() const;
+
+    /**
+     * @brief The distance between two neighboring x values of an implicit x
+     * axis.
+     * @return The x increment. Undefined for explicit x values.
+     */
+    [[nodiscard]] double getXIncrement() const;
+
+    /**
+     * @brief The x value of a point.
+     * @param index The index of the point.
+     * @return The x value.
+     * @throws std::out_of_range If the index is out of range.
+     */
+    [[nodiscard]] double getX(size_t index) const;
+
+    /**
+     * @brief The y value of a point.
+     * @param index The index of the point.
+     * @return The y value. Invalid values ("?") are represented by
+     * std::numeric_limits<double>::quiet_NaN.
+     * @throws std::out_of_range If the index is out of range.
+     */
+    [[nodiscard]] double getY(size_t index) const;
+
+    /**
+     * @brief All x values. Computed for an implicit x axis.
+     * @return The x values.
+     */
+    [[nodiscard]] std::vector<double> getXValues() const;
+
+    /**
+     * @brief The stored x values.
+     * @return The x values. Empty for an implicit x axis.
+     */
+    [[nodiscard]] const std::vector<double>& getExplicitXValues() const;
+
+    /**
+     * @brief All y values.
+     * @return The y values. Invalid values ("?") are represented by
+     * std::numeric_limits<double>::quiet_NaN.
+     */
+    [[nodiscard]] const std::vector<double>& getYValues() const;
+
+    /**
+     * @brief The points as xy pairs.
+     * @return Pairs of xy data.
+     */
+    [[nodiscard]] std::vector<std::pair<double, double>> toPairs() const;
+
+private:
+    std::shared_ptr<const std::vector<double>> m_xValues;
+    std::shared_ptr<const std::vector<double>> m_yValues;
+    bool m_hasImplicitX;
+    double m_firstX;
+    double m_xIncrement;
+};
+} // namespace libjdx::jdx
+
+#endif // JDX_SPECTRUM_HPP
@@ -20,7 +20,9 @@
 
 #include "jdx/Ldr.hpp"
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 namespace libjdx::jdx
 {
@@ -34,19 +36,33 @@ public:
      * @brief Constructs a Ldr from label and string value.
      * @param label The label of the LDR, e.g. "TITLE" for "##TITLE= abc".
      * @param value The value of the LDR, e.g. "abc" for "##TITLE= abc".
+     * @param resource The memory resource to allocate the text from, e.g.,
+     * the arena of the containing Block. It must outlive the Ldr. Copies of
+     * the Ldr use the default resource.
      */
-    StringLdr(std::string label, std::string value);
+    StringLdr(std::string_view label, std::string_view value,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief The value (without initial blank character if any) of the
      * LDR, e.g. "abc" for "##TITLE= abc".
-     * @return The value of the LDR. If the value spans multiple lines, the
-     * return value contains all lines, separated by \"\\n\".
+     * @return A copy of the value of the LDR.
+     * @deprecated Use getValueView(), which does not copy the value.
      */
-    [[nodiscard]] const std::string& getValue() const;
+    [[nodiscard, deprecated("Use getValueView() instead.")]] std::string
+    getValue() const;
+
+    /**
+     * @brief The value (without initial blank character if any) of the
+     * LDR, e.g. "abc" for "##TITLE= abc".
+     * @return A view of the value, valid for the lifetime of this object. If
+     * the value spans multiple lines, the view contains all lines, separated
+     * by \"\\n\".
+     */
+    [[nodiscard]] std::string_view getValueView() const;
 
 private:
-    const std::string m_value;
+    std::pmr::string m_value;
 };
 } // namespace libjdx::jdx
 
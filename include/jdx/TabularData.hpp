@@ -22,8 +22,8 @@
 #include "jdx/DataLdr.hpp"
 
 #include <functional>
-#include <regex>
 #include <string>
+#include <string_view>
 
 namespace libjdx::jdx
 {
@@ -49,20 +49,30 @@ protected:
 
     /**
      * @brief Provides the parsed peak assignments or peaks.
-     * @param Parser for the data.
+     * @tparam Parser Parser for the data, constructible from a reader and a
+     * variable list.
+     * @param variableList The variable list passed to the parser.
      * @return The list of peak assignments or peaks.
      */
     template<typename Parser, typename R>
-    std::vector<R> getData(Parser parser) const;
+    std::vector<R> getData(const std::string& variableList) const;
+
+private:
+    /**
+     * @brief Checks whether a line only contains a $$ comment, i.e., matches
+     * "^[ \t\n\v\f\r]*\$\$.*$".
+     * @param line The line.
+     * @return True if the line only contains a $$ comment, false otherwise.
+     */
+    static bool isPureCommentLine(std::string_view line);
 };
 
 template<typename Parser, typename R>
-std::vector<R> libjdx::jdx::TabularData::getData(Parser parser) const
+std::vector<R> libjdx::jdx::TabularData::getData(
+    const std::string& variableList) const
 {
-    const static std::regex pureCommentRegex{"^[ \t\n\v\f\r]*\\$\\$.*$"};
-    auto func = [&]() {
+    auto func = [&variableList](io::TextReader& reader) {
         std::vector<R> data{};
-        auto& reader = getReader();
 
         // TODO: use util::skipPureComments() but don't expose private header
         // skip possible initial comment lines
@@ -70,8 +80,8 @@ std::vector<R> libjdx::jdx::TabularData::getData(Parser parser) const
         while (!reader.eof())
         {
             pos = reader.tellg();
-            auto line = reader.readLine();
-            if (!std::regex_match(line, pureCommentRegex))
+            auto line = reader.readLineView();
+            if (!isPureCommentLine(line))
             {
                 // not pure comment
                 break;
@@ -83,6 +93,7 @@ std::vector<R> libjdx::jdx::TabularData::getData(Parser parser) const
         }
 
         // read peaks
+        Parser parser{reader, variableList};
         while (auto next = parser.next())
         {
             data.push_back(std::move(next.value()));
@@ -90,7 +101,7 @@ std::vector<R> libjdx::jdx::TabularData::getData(Parser parser) const
         return data;
     };
 
-    return callAndResetStreamPos<std::vector<R>>(func);
+    return readData<std::vector<R>>(func);
 }
 
 } // namespace libjdx::jdx
@@ -20,6 +20,7 @@
 
 #include "io/TextReader.hpp"
 #include "jdx/Data2D.hpp"
+#include "jdx/Spectrum.hpp"
 #include "jdx/StringLdr.hpp"
 #include "jdx/XyParameters.hpp"
 
@@ -64,17 +65,37 @@ protected:
 
     /**
      * @brief Provides the parsed xy data of type (X++(Y..Y)) and similar.
-     * @return Pairs of xy data. Invalid values ("?") will be represented by
-     * std::numeric_limits<double>::quiet_NaN.
+     * @return The xy data with an implicit equidistant x axis. Invalid values
+     * ("?") will be represented by std::numeric_limits<double>::quiet_NaN.
      */
-    [[nodiscard]] std::vector<std::pair<double, double>> getXppYYData() const;
+    [[nodiscard]] Spectrum getXppYYData() const;
 
     /**
      * @brief Provides the parsed xy data of type (XY..XY) and similar.
-     * @return Pairs of xy data. Invalid values ("?") will be represented by
-     * std::numeric_limits<double>::quiet_NaN.
+     * @return The xy data with explicit x values. Invalid values ("?") will be
+     * represented by std::numeric_limits<double>::quiet_NaN.
      */
-    [[nodiscard]] std::vector<std::pair<double, double>> getXYXYData() const;
+    [[nodiscard]] Spectrum getXYXYData() const;
+
+    /**
+     * @brief Decodes the xy data of type (X++(Y..Y)) and similar into caller
+     * provided buffers.
+     * @param x Buffer for the x values or nullptr if not required.
+     * @param y Buffer for the y values.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written.
+     */
+    size_t decodeXppYYInto(double* x, double* y, size_t size) const;
+
+    /**
+     * @brief Decodes the xy data of type (XY..XY) and similar into caller
+     * provided buffers.
+     * @param x Buffer for the x values or nullptr if not required.
+     * @param y Buffer for the y values.
+     * @param size The number of values each buffer can hold.
+     * @return The number of points written.
+     */
+    size_t decodeXYXYInto(double* x, double* y, size_t size) const;
 
 private:
     XyParameters m_parameters;
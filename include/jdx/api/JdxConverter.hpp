@@ -22,6 +22,7 @@
 #include "api/Node.hpp"
 #include "api/Table.hpp"
 #include "jdx/Block.hpp"
+#include "jdx/ParseOptions.hpp"
 
 namespace libjdx::jdx::api
 {
@@ -34,6 +35,14 @@ public:
      */
     explicit JdxConverter(const std::string& path);
 
+    /**
+     * Constructs a JdxConverter from a path.
+     * @param path Path to the data set.
+     * @param options Parse options, e.g., for lazily parsing with an index
+     * file.
+     */
+    JdxConverter(const std::string& path, const ParseOptions& options);
+
     /**
      * @brief Read node from data set.
      * @param path Path to the node within the data set.
@@ -58,7 +67,7 @@ private:
     static std::string mapNTuplesPageName(const Page& page);
     static std::vector<libjdx::api::Point2D> mapData(const Block& block);
     static std::vector<libjdx::api::Point2D> mapXyData(
-        const std::vector<std::pair<double, double>>& xyData);
+        const Spectrum& spectrum);
     static std::map<std::string, std::string> mapMetadata(const Block& block);
     static std::map<std::string, std::string> mapMetadata(
         const Page& page, bool isPeakData);
@@ -66,8 +75,7 @@ private:
         const libjdx::jdx::PeakTable& peakTable);
     static std::vector<libjdx::api::Point2D> mapPeakTableAsData(
         const libjdx::jdx::PeakTable& peakTable);
-    static libjdx::api::Table mapDataAsPeakTable(
-        const std::vector<std::pair<double, double>>& xyData);
+    static libjdx::api::Table mapDataAsPeakTable(const Spectrum& spectrum);
     static libjdx::api::Table mapPeakAssignments(
         const libjdx::jdx::PeakAssignments& peakAssignments);
     static libjdx::api::Node mapAuditTrail(
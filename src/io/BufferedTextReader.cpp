@@ -25,27 +25,44 @@
 #include <vector>
 
 libjdx::io::BufferedTextReader::BufferedTextReader(
-    std::unique_ptr<std::istream> streamPtr, size_t bufferSize)
+    std::unique_ptr<std::istream> streamPtr, size_t bufferSize, bool readAhead)
     : m_streamPtr{std::move(streamPtr)}
-    , m_bufferMaxSize{bufferSize}
-    , m_buffer(bufferSize)
+    , m_length{0}
+    , m_bufferInitialSize{std::max(bufferSize, size_t{1})}
+    , m_bufferMaxSize{std::max(m_bufferInitialSize, s_bufferMaxSize)}
+    , m_chunkSize{m_bufferInitialSize}
     , m_bufferBasePos{0}
     , m_bufferPosIt{m_buffer.begin()}
+    , m_readAhead{readAhead}
+    , m_nextBufferBasePos{0}
 {
+#ifdef __EMSCRIPTEN__
+    // no threads available
+    m_readAhead = false;
+#endif
     setStreamFlags();
+    // the data is not expected to change, so only determine its length once
+    const std::ios::pos_type current = m_streamPtr->tellg();
+    m_streamPtr->seekg(0, std::ios::end);
+    m_length = m_streamPtr->tellg();
+    m_streamPtr->seekg(current, std::ios::beg);
     updateBuffer(0);
 }
 
 libjdx::io::BufferedTextReader::BufferedTextReader(
-    const std::string& filePath, size_t bufferSize)
-    : m_streamPtr{std::make_unique<std::ifstream>(filePath)}
-    , m_bufferMaxSize{bufferSize}
-    , m_buffer(bufferSize)
-    , m_bufferBasePos{0}
-    , m_bufferPosIt{m_buffer.begin()}
+    const std::string& filePath, size_t bufferSize, bool readAhead)
+    : BufferedTextReader(
+        std::make_unique<std::ifstream>(filePath), bufferSize, readAhead)
 {
-    setStreamFlags();
-    updateBuffer(0);
+}
+
+libjdx::io::BufferedTextReader::~BufferedTextReader()
+{
+    // the background read must not outlive the stream and buffer
+    if (m_readAheadResult.valid())
+    {
+        m_readAheadResult.wait();
+    }
 }
 
 void libjdx::io::BufferedTextReader::setStreamFlags()
@@ -70,37 +87,116 @@ std::ios::pos_type libjdx::io::BufferedTextReader::calculateAbsolutePosition(
     }
     else if (seekdir == std::ios_base::cur)
     {
-        pos = m_bufferBasePos
-              + static_cast<std::ios::pos_type>(
-                  std::distance(m_buffer.cbegin(), m_bufferPosIt))
-              + position;
+        pos = tellg() + position;
     }
     else if (seekdir == std::ios_base::end)
     {
-        pos = getLength() - position;
+        pos = getLength() + position;
     }
     return pos;
 }
 
-void libjdx::io::BufferedTextReader::updateBuffer(std::ios::pos_type position)
+void libjdx::io::BufferedTextReader::readChunk(
+    std::vector<char>& buffer, std::ios::pos_type position, size_t size)
 {
-    // NOLINTBEGIN(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-    auto bufferStartPos = static_cast<std::ios::pos_type>(
-        (position / m_bufferMaxSize) * m_bufferMaxSize);
-    m_streamPtr->seekg(bufferStartPos);
-    m_buffer.resize(m_bufferMaxSize);
-    m_streamPtr->read(m_buffer.data(), m_bufferMaxSize);
+    m_streamPtr->seekg(position);
+    buffer.resize(size);
+    m_streamPtr->read(buffer.data(), static_cast<std::streamsize>(size));
     const auto numCharsRead = m_streamPtr->gcount();
     if (m_streamPtr->eof())
     {
         m_streamPtr->clear();
     }
-    m_buffer.resize(numCharsRead);
-    m_bufferBasePos = bufferStartPos;
+    buffer.resize(static_cast<size_t>(numCharsRead));
+}
+
+void libjdx::io::BufferedTextReader::startReadAhead()
+{
+    const auto nextPos = m_bufferBasePos
+                         + static_cast<std::ios::pos_type>(m_buffer.size());
+    if (!m_readAhead || nextPos >= m_length)
+    {
+        return;
+    }
+    m_nextBufferBasePos = nextPos;
+    m_readAheadResult = std::async(
+        std::launch::async, [this, nextPos, size = m_chunkSize]() {
+            readChunk(m_nextBuffer, nextPos, size);
+        });
+}
+
+void libjdx::io::BufferedTextReader::finishReadAhead()
+{
+    if (!m_readAheadResult.valid())
+    {
+        return;
+    }
+    try
+    {
+        m_readAheadResult.get();
+    }
+    catch (...)
+    {
+        // contents undefined
+        m_nextBuffer.clear();
+        throw;
+    }
+}
+
+void libjdx::io::BufferedTextReader::updateBuffer(std::ios::pos_type position)
+{
+    finishReadAhead();
+    // NOLINTBEGIN(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+    // random access => use small buffer
+    m_chunkSize = m_bufferInitialSize;
+    const auto nextBufferEndPos
+        = m_nextBufferBasePos
+          + static_cast<std::ios::pos_type>(m_nextBuffer.size());
+    if (!m_nextBuffer.empty() && position >= m_nextBufferBasePos
+        && position < nextBufferEndPos)
+    {
+        // new pos inside chunk read ahead => swap buffers
+        std::swap(m_buffer, m_nextBuffer);
+        std::swap(m_bufferBasePos, m_nextBufferBasePos);
+    }
+    else
+    {
+        auto bufferStartPos = static_cast<std::ios::pos_type>(
+            (position / m_bufferInitialSize) * m_bufferInitialSize);
+        readChunk(m_buffer, bufferStartPos, m_chunkSize);
+        m_bufferBasePos = bufferStartPos;
+    }
     m_bufferPosIt = std::begin(m_buffer)
                     + static_cast<std::vector<char>::difference_type>(
-                        position - bufferStartPos);
+                        position - m_bufferBasePos);
     // NOLINTEND(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+    startReadAhead();
+}
+
+void libjdx::io::BufferedTextReader::loadNextChunk()
+{
+    finishReadAhead();
+    const auto nextPos = m_bufferBasePos
+                         + static_cast<std::ios::pos_type>(m_buffer.size());
+    // sequential access => grow buffer to reduce the number of reads
+    m_chunkSize = std::min(m_chunkSize * 2, m_bufferMaxSize);
+    if (!m_nextBuffer.empty() && m_nextBufferBasePos == nextPos)
+    {
+        // chunk already read ahead
+        std::swap(m_buffer, m_nextBuffer);
+        std::swap(m_bufferBasePos, m_nextBufferBasePos);
+    }
+    else
+    {
+        readChunk(m_buffer, nextPos, m_chunkSize);
+        m_bufferBasePos = nextPos;
+    }
+    m_bufferPosIt = m_buffer.cbegin();
+    if (m_buffer.empty())
+    {
+        throw std::runtime_error("Error reading chunk from istream.");
+    }
+    startReadAhead();
 }
 
 std::ios::pos_type libjdx::io::BufferedTextReader::tellg() const
@@ -114,6 +210,7 @@ void libjdx::io::BufferedTextReader::seekg(
     std::ios::off_type position, std::ios_base::seekdir seekdir)
 {
     auto pos = calculateAbsolutePosition(position, seekdir);
+    m_lineStartPos.reset();
     // NOLINTBEGIN(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
     if (pos >= m_bufferBasePos
         && pos < m_bufferBasePos
@@ -121,7 +218,7 @@ void libjdx::io::BufferedTextReader::seekg(
     // NOLINTEND(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
     {
         // new pos inside existing buffer => only update m_bufferPosIt
-        auto newBufferPos = position - m_bufferBasePos;
+        auto newBufferPos = pos - m_bufferBasePos;
         m_bufferPosIt
             = m_buffer.cbegin()
               + static_cast<std::vector<char>::difference_type>(newBufferPos);
@@ -146,78 +243,71 @@ void libjdx::io::BufferedTextReader::seekg(
     }
 }
 
-std::ios::pos_type libjdx::io::BufferedTextReader::getLength()
+std::ios::pos_type libjdx::io::BufferedTextReader::getLength() const
 {
-    const std::ios::pos_type current = m_streamPtr->tellg();
-    m_streamPtr->seekg(0, std::ios::end);
-    const std::ios::pos_type length = m_streamPtr->tellg();
-    m_streamPtr->seekg(current, std::ios::beg);
-    return length;
+    return m_length;
 }
 
 bool libjdx::io::BufferedTextReader::eof() const
 {
-    // static cast is safe as distance from the beginning cannot benegative
-    if (static_cast<size_t>(std::distance(m_buffer.cbegin(), m_bufferPosIt))
-        < m_buffer.size())
-    {
-        return false;
-    }
-    // see:
-    // https://stackoverflow.com/questions/6283632/how-to-know-if-the-next-character-is-eof-in-c
-    auto c = m_streamPtr->peek();
-    if (c == EOF)
-    {
-        if (m_streamPtr->eof())
-        {
-            // otherwise operations no longer works after eofbit is set
-            m_streamPtr->clear();
-            return true;
-        }
-        throw std::runtime_error(
-            "End of file reached, but std::ios::eofbit not set.");
-    }
-    return false;
+    return tellg() >= m_length;
 }
 
 std::string libjdx::io::BufferedTextReader::readLine()
 {
-    // NOLINTBEGIN(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-    auto nextChunkStartPos
-        = m_bufferBasePos + static_cast<std::ios::pos_type>(m_bufferMaxSize);
-    if (m_bufferPosIt == m_buffer.cend() && nextChunkStartPos >= getLength())
+    return std::string{readLineView()};
+}
+
+std::string_view libjdx::io::BufferedTextReader::readLineView()
+{
+    if (eof())
     {
         throw std::runtime_error("Error reading line from istream.");
     }
+    m_lineStartPos = tellg();
     auto posIt = std::find(m_bufferPosIt, m_buffer.cend(), '\n');
-    std::string out{m_bufferPosIt, posIt};
     auto lfFound = posIt != m_buffer.cend();
-    // set new buffer position either past end or past found LF
-    m_bufferPosIt = lfFound ? ++posIt : m_buffer.cend();
-    while (!lfFound && nextChunkStartPos < getLength())
-    {
-        // no LF encountered => load next chunk if available and continue search
-        updateBuffer(nextChunkStartPos);
-        nextChunkStartPos = m_bufferBasePos
-                            + static_cast<std::ios::pos_type>(m_bufferMaxSize);
-        posIt = std::find(m_bufferPosIt, m_buffer.cend(), '\n');
-        out.append(m_bufferPosIt, posIt);
-        lfFound = posIt != m_buffer.cend();
-        // set new buffer position either past end or past found LF
-        m_bufferPosIt = lfFound ? ++posIt : m_buffer.cend();
+    std::string_view out{};
+    if (lfFound)
+    {
+        // line completely inside buffer => no need to copy
+        out = std::string_view{&*m_bufferPosIt,
+            static_cast<size_t>(std::distance(m_bufferPosIt, posIt))};
+        m_bufferPosIt = ++posIt;
     }
-    // NOLINTEND(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-    if (m_streamPtr->eof())
+    else
     {
-        // cleat eofbit, so that other operations will still succeed
-        // other types of errors raise exceptions
-        m_streamPtr->clear();
+        // line spans chunks => assemble it in m_line
+        m_line.assign(m_bufferPosIt, posIt);
+        m_bufferPosIt = m_buffer.cend();
+        while (!lfFound && !eof())
+        {
+            // no LF encountered => load next chunk if available and continue
+            // search
+            loadNextChunk();
+            posIt = std::find(m_bufferPosIt, m_buffer.cend(), '\n');
+            m_line.append(m_bufferPosIt, posIt);
+            lfFound = posIt != m_buffer.cend();
+            // set new buffer position either past end or past found LF
+            m_bufferPosIt = lfFound ? ++posIt : m_buffer.cend();
+        }
+        out = m_line;
     }
-    if (!out.empty() && out.at(out.size() - 1) == '\r')
+    if (!out.empty() && out.back() == '\r')
     {
         // remove trailing \r in case line ending is \r\n and has not been
         // converted to \n by stream already
-        out.erase(out.size() - 1);
+        out.remove_suffix(1);
     }
     return out;
 }
+
+void libjdx::io::BufferedTextReader::unreadLine()
+{
+    if (!m_lineStartPos)
+    {
+        throw std::runtime_error("No line to unread.");
+    }
+    // usually inside the buffer => no stream access
+    seekg(m_lineStartPos.value());
+}
@@ -0,0 +1,318 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "io/MappedTextReader.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#if defined(__has_include)
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>)                \
+    && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_USE_MMAP 1
+#endif
+#endif
+
+#if defined(JDX_USE_MMAP) && defined(__linux__)
+#if __has_include(<sys/vfs.h>)
+#include <sys/vfs.h>
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_USE_STATFS 1
+#endif
+#endif
+
+namespace
+{
+#ifdef JDX_USE_STATFS
+// file system magic number of FUSE mounts, whose files may change or vanish
+// without notice
+constexpr uint32_t s_fuseSuperMagic = 0x65735546;
+#endif
+} // namespace
+
+libjdx::io::MappedTextReader::MappedTextReader(
+    std::unique_ptr<std::istream> streamPtr)
+    : m_data{nullptr}
+    , m_size{0}
+    , m_pos{0}
+{
+    if (streamPtr == nullptr)
+    {
+        throw std::runtime_error("Text reader input stream is null.");
+    }
+    streamPtr->exceptions(std::ios::badbit);
+    auto source = std::make_shared<Source>();
+    source->buffer.assign(std::istreambuf_iterator<char>{*streamPtr},
+        std::istreambuf_iterator<char>{});
+    m_data = source->data();
+    m_size = source->size();
+    m_source = std::move(source);
+}
+
+libjdx::io::MappedTextReader::MappedTextReader(const std::string& filePath)
+    : MappedTextReader(mapFile(filePath))
+{
+}
+
+libjdx::io::MappedTextReader::MappedTextReader(
+    std::shared_ptr<const std::vector<char>> buffer)
+    : MappedTextReader(wrapBuffer(std::move(buffer)))
+{
+}
+
+libjdx::io::MappedTextReader::MappedTextReader(
+    std::shared_ptr<const Source> source)
+    : m_source{std::move(source)}
+    , m_data{m_source->data()}
+    , m_size{m_source->size()}
+    , m_pos{0}
+{
+}
+
+libjdx::io::MappedTextReader::~MappedTextReader() = default;
+
+bool libjdx::io::MappedTextReader::isMappingSafe(const std::string& filePath)
+{
+#ifdef JDX_USE_STATFS
+    struct statfs fsStat
+    {
+    };
+    // errors are reported when actually opening the file
+    return statfs(filePath.c_str(), &fsStat) != 0
+           || static_cast<uint32_t>(fsStat.f_type) != s_fuseSuperMagic;
+#else
+    static_cast<void>(filePath);
+    return true;
+#endif
+}
+
+libjdx::io::MappedTextReader::Source::~Source()
+{
+#ifdef JDX_USE_MMAP
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappingSize);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+#endif
+}
+
+const char* libjdx::io::MappedTextReader::Source::data() const
+{
+    if (mapping != nullptr)
+    {
+        return static_cast<const char*>(mapping);
+    }
+    return sharedBuffer != nullptr ? sharedBuffer->data() : buffer.data();
+}
+
+size_t libjdx::io::MappedTextReader::Source::size() const
+{
+    if (mapping != nullptr)
+    {
+        return mappingSize;
+    }
+    return sharedBuffer != nullptr ? sharedBuffer->size() : buffer.size();
+}
+
+bool libjdx::io::MappedTextReader::Source::isTruncated() const
+{
+#ifdef JDX_USE_MMAP
+    if (mapping == nullptr || fd < 0)
+    {
+        return false;
+    }
+    struct stat fileStat
+    {
+    };
+    return fstat(fd, &fileStat) != 0
+           || static_cast<size_t>(fileStat.st_size) < mappingSize;
+#else
+    return false;
+#endif
+}
+
+std::shared_ptr<const libjdx::io::MappedTextReader::Source>
+libjdx::io::MappedTextReader::wrapBuffer(
+    std::shared_ptr<const std::vector<char>> buffer)
+{
+    if (buffer == nullptr)
+    {
+        throw std::invalid_argument("Text reader buffer is null.");
+    }
+    auto source = std::make_shared<Source>();
+    source->sharedBuffer = std::move(buffer);
+    return source;
+}
+
+std::shared_ptr<const libjdx::io::MappedTextReader::Source>
+libjdx::io::MappedTextReader::mapFile(const std::string& filePath)
+{
+    auto source = std::make_shared<Source>();
+#ifdef JDX_USE_MMAP
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    const int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Could not open file: " + filePath);
+    }
+    struct stat fileStat
+    {
+    };
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw std::runtime_error(
+            "Could not determine size of file: " + filePath);
+    }
+    const auto fileSize = static_cast<size_t>(fileStat.st_size);
+    if (!S_ISREG(fileStat.st_mode) || fileSize == 0)
+    {
+        // zero length mappings are illegal, pipes and devices can not be
+        // mapped and virtual files (e.g., in /proc) report a zero size
+        close(fd);
+        readFile(filePath, *source);
+        return source;
+    }
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    if (mapping == MAP_FAILED)
+    {
+        close(fd);
+        throw std::runtime_error("Could not map file: " + filePath);
+    }
+    // lines are mostly read front to back
+    madvise(mapping, fileSize, MADV_SEQUENTIAL);
+    source->mapping = mapping;
+    source->mappingSize = fileSize;
+    source->fd = fd;
+#else
+    readFile(filePath, *source);
+#endif
+    return source;
+}
+
+void libjdx::io::MappedTextReader::readFile(
+    const std::string& filePath, Source& source)
+{
+    std::ifstream stream{filePath, std::ios::binary};
+    if (!stream)
+    {
+        throw std::runtime_error("Could not open file: " + filePath);
+    }
+    source.buffer.assign(std::istreambuf_iterator<char>{stream},
+        std::istreambuf_iterator<char>{});
+}
+
+std::unique_ptr<libjdx::io::MappedTextReader>
+libjdx::io::MappedTextReader::createCursor() const
+{
+    // private constructor => no std::make_unique()
+    return std::unique_ptr<MappedTextReader>(new MappedTextReader(m_source));
+}
+
+std::ios::pos_type libjdx::io::MappedTextReader::tellg() const
+{
+    return static_cast<std::ios::pos_type>(m_pos);
+}
+
+void libjdx::io::MappedTextReader::seekg(
+    std::ios::off_type position, std::ios_base::seekdir seekdir)
+{
+    std::ios::off_type base = 0;
+    if (seekdir == std::ios_base::cur)
+    {
+        base = static_cast<std::ios::off_type>(m_pos);
+    }
+    else if (seekdir == std::ios_base::end)
+    {
+        base = static_cast<std::ios::off_type>(m_size);
+    }
+    const auto pos = base + position;
+    if (pos < 0 || pos > static_cast<std::ios::off_type>(m_size))
+    {
+        throw std::runtime_error(
+            "Illegal seek position: " + std::to_string(pos));
+    }
+    if (m_source->isTruncated())
+    {
+        // reading lost parts of the mapping would raise SIGBUS
+        throw std::runtime_error("File has been truncated while reading.");
+    }
+    m_pos = static_cast<size_t>(pos);
+    m_lineStart.reset();
+}
+
+std::ios::pos_type libjdx::io::MappedTextReader::getLength() const
+{
+    return static_cast<std::ios::pos_type>(m_size);
+}
+
+bool libjdx::io::MappedTextReader::eof() const
+{
+    return m_pos >= m_size;
+}
+
+std::string libjdx::io::MappedTextReader::readLine()
+{
+    return std::string{readLineView()};
+}
+
+std::string_view libjdx::io::MappedTextReader::readLineView()
+{
+    if (m_pos >= m_size)
+    {
+        throw std::runtime_error("Error reading line past end of data.");
+    }
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const char* start = m_data + m_pos;
+    m_lineStart = m_pos;
+    const auto remaining = m_size - m_pos;
+    const auto* lf
+        = static_cast<const char*>(std::memchr(start, '\n', remaining));
+    auto length = lf == nullptr ? remaining : static_cast<size_t>(lf - start);
+    // skip LF if present
+    m_pos += lf == nullptr ? length : length + 1;
+    if (length > 0 && start[length - 1] == '\r')
+    {
+        // remove trailing \r in case line ending is \r\n
+        --length;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::string_view{start, length};
+}
+
+void libjdx::io::MappedTextReader::unreadLine()
+{
+    if (!m_lineStart)
+    {
+        throw std::runtime_error("No line to unread.");
+    }
+    m_pos = m_lineStart.value();
+    m_lineStart.reset();
+}
@@ -54,6 +54,7 @@ void libjdx::io::SimpleTextReader::seekg(
     std::ios::pos_type position, std::ios_base::seekdir seekdir)
 {
     m_streamPtr->seekg(position, seekdir);
+    m_lineLength.reset();
 }
 
 std::ios::pos_type libjdx::io::SimpleTextReader::getLength()
@@ -86,22 +87,41 @@ bool libjdx::io::SimpleTextReader::eof() const
 
 std::string libjdx::io::SimpleTextReader::readLine()
 {
-    std::string out{};
-    if (std::getline(*m_streamPtr, out))
+    return std::string{readLineView()};
+}
+
+std::string_view libjdx::io::SimpleTextReader::readLineView()
+{
+    // reuse m_line so that its capacity is retained across lines
+    if (std::getline(*m_streamPtr, m_line))
     {
+        // getline() consumes the LF unless the end of the stream is reached
+        m_lineLength = static_cast<std::ios::off_type>(m_line.size())
+                       + (m_streamPtr->eof() ? 0 : 1);
         if (m_streamPtr->eof())
         {
             // cleat eofbit, so that other operations will still succeed
             // other types of errors raise exceptions
             m_streamPtr->clear();
         }
-        if (!out.empty() && out.at(out.size() - 1) == '\r')
+        std::string_view out{m_line};
+        if (!out.empty() && out.back() == '\r')
         {
             // remove trailing \r in case line ending is \r\n and has not been
             // converted to \n by stream already
-            out.erase(out.size() - 1);
+            out.remove_suffix(1);
         }
         return out;
     }
     throw std::runtime_error("Error reading line from istream.");
 }
+
+void libjdx::io::SimpleTextReader::unreadLine()
+{
+    if (!m_lineLength)
+    {
+        throw std::runtime_error("No line to unread.");
+    }
+    m_streamPtr->seekg(-m_lineLength.value(), std::ios_base::cur);
+    m_lineLength.reset();
+}
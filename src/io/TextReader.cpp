@@ -0,0 +1,68 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "io/TextReader.hpp"
+#include "io/BufferedTextReader.hpp"
+#include "io/MappedTextReader.hpp"
+
+#ifdef __EMSCRIPTEN__
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_DEFAULT_TEXT_READER BufferedTextReader
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_DEFAULT_TEXT_READER MappedTextReader
+#endif
+
+libjdx::io::TextReader::TextReader(std::unique_ptr<std::istream> streamPtr)
+    : TextReader(
+        std::make_unique<JDX_DEFAULT_TEXT_READER>(std::move(streamPtr)))
+{
+}
+
+libjdx::io::TextReader::TextReader(const std::string& filePath)
+    : TextReader(openFile(filePath))
+{
+}
+
+libjdx::io::TextReader::TextReader(std::unique_ptr<Concept> reader)
+    : m_reader{std::move(reader)}
+{
+}
+
+libjdx::io::TextReader::~TextReader() = default;
+
+std::unique_ptr<libjdx::io::TextReader::Concept>
+libjdx::io::TextReader::openFile(const std::string& filePath)
+{
+#ifndef __EMSCRIPTEN__
+    if (!MappedTextReader::isMappingSafe(filePath))
+    {
+        return std::make_unique<Model<BufferedTextReader>>(
+            std::make_unique<BufferedTextReader>(filePath));
+    }
+#endif
+    return std::make_unique<Model<JDX_DEFAULT_TEXT_READER>>(
+        std::make_unique<JDX_DEFAULT_TEXT_READER>(filePath));
+}
+
+std::unique_ptr<libjdx::io::TextReader>
+libjdx::io::TextReader::createCursor() const
+{
+    // private constructor => no std::make_unique()
+    return std::unique_ptr<TextReader>(
+        new TextReader(m_reader->createCursor()));
+}
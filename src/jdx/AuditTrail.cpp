@@ -29,7 +29,7 @@ libjdx::jdx::AuditTrail::AuditTrail(const std::string& label,
 {
     auto varList = getVariableList();
     util::trim(varList);
-    validateInput(getLabel(), varList, s_label,
+    validateInput(getLabelView(), varList, s_label,
         std::vector<std::string>{
             std::begin(s_variableLists), std::end(s_variableLists)});
 
@@ -37,7 +37,7 @@ libjdx::jdx::AuditTrail::AuditTrail(const std::string& label,
     m_brukerVarList = scanForBrukerVarList(nextLine);
     if (m_brukerVarList)
     {
-        validateInput(getLabel(), m_brukerVarList.value(), s_label,
+        validateInput(getLabelView(), m_brukerVarList.value(), s_label,
             std::vector<std::string>{
                 std::begin(s_variableLists), std::end(s_variableLists)});
     }
@@ -55,9 +55,8 @@ libjdx::jdx::AuditTrail::getData() const
         variableList
             = util::stripLineComment(variableList, false, true).second.value();
     }
-    util::AuditTrailParser parser{getReader(), variableList};
     return TabularData::getData<util::AuditTrailParser, AuditTrailEntry>(
-        parser);
+        variableList);
 }
 
 std::optional<std::string> libjdx::jdx::AuditTrail::scanForBrukerVarList(
@@ -16,46 +16,232 @@
  * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "jdx/Block.hpp"
+#include "util/Arena.hpp"
 #include "util/LdrUtils.hpp"
 #include "util/StringUtils.hpp"
+#include "util/ThreadPool.hpp"
 
-libjdx::jdx::Block::Block(std::unique_ptr<io::TextReader> readerPtr)
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace
+{
+/**
+ * @brief Labels of data records. Their positions are indexed when scanning a
+ * block. Regular LDRs following any of these are not indexed.
+ */
+constexpr std::array<const char*, 7> s_dataRecordLabels
+    = {"XYDATA", "RADATA", "XYPOINTS", "PEAKTABLE", "PEAKASSIGNMENTS",
+        "NTUPLES", "AUDITTRAIL"};
+} // namespace
+
+libjdx::jdx::Block::Block(
+    std::unique_ptr<io::TextReader> readerPtr, const ParseOptions& options)
     : m_readerPtr{std::move(readerPtr)}
     , m_reader{*m_readerPtr}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_isLdrIndexComplete{false}
 {
+    m_titlePos = m_reader.tellg();
     auto firstLine = m_reader.readLine();
-    auto titleFirstLine = parseFirstLine(firstLine);
-    std::optional<std::string> nextLine;
-    parseInput(titleFirstLine, nextLine);
+    parse(parseFirstLine(firstLine), options);
 }
 
-libjdx::jdx::Block::Block(io::TextReader& reader)
+libjdx::jdx::Block::Block(io::TextReader& reader, const ParseOptions& options)
     : m_readerPtr{nullptr}
     , m_reader{reader}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_isLdrIndexComplete{false}
 {
+    m_titlePos = reader.tellg();
     auto firstLine = reader.readLine();
-    auto titleFirstLine = parseFirstLine(firstLine);
-    std::optional<std::string> nextLine;
-    parseInput(titleFirstLine, nextLine);
+    parse(parseFirstLine(firstLine), options);
 }
 
 libjdx::jdx::Block::Block(const std::string& title, io::TextReader& reader,
     std::optional<std::string>& nextLine)
     : m_readerPtr{nullptr}
     , m_reader{reader}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_isLdrIndexComplete{false}
+{
+    parseInput(title, reader, nextLine, m_content.emplace(), &m_blocks);
+}
+
+libjdx::jdx::Block::Block(io::TextReader& reader, std::streampos titlePos)
+    : m_readerPtr{nullptr}
+    , m_reader{reader}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_lazyParsing{std::make_unique<LazyParsing>()}
+    , m_titlePos{titlePos}
+    , m_isLdrIndexComplete{false}
+{
+    scanInput();
+}
+
+libjdx::jdx::Block::Block(std::unique_ptr<io::TextReader> readerPtr,
+    std::streampos titlePos, std::streampos endPos)
+    : m_readerPtr{std::move(readerPtr)}
+    , m_reader{*m_readerPtr}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_titlePos{titlePos}
+    , m_endPos{endPos}
+    , m_isLdrIndexComplete{false}
+{
+    m_reader.seekg(m_titlePos);
+    auto titleFirstLine = parseFirstLine(m_reader.readLine());
+    std::optional<std::string> nextLine;
+    parseInput(
+        titleFirstLine, m_reader, nextLine, m_content.emplace(), &m_blocks);
+}
+
+libjdx::jdx::Block::Block(
+    std::unique_ptr<io::TextReader> readerPtr, std::istream& indexStream)
+    : m_readerPtr{std::move(readerPtr)}
+    , m_reader{*m_readerPtr}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_lazyParsing{std::make_unique<LazyParsing>()}
+    , m_isLdrIndexComplete{false}
+{
+    readIndex(indexStream);
+}
+
+libjdx::jdx::Block::Block(io::TextReader& reader, std::istream& indexStream)
+    : m_readerPtr{nullptr}
+    , m_reader{reader}
+    , m_arena{std::make_unique<util::Arena>()}
+    , m_lazyParsing{std::make_unique<LazyParsing>()}
+    , m_isLdrIndexComplete{false}
+{
+    readIndex(indexStream);
+}
+
+void libjdx::jdx::Block::writeIndex(std::ostream& indexStream) const
+{
+    // one line per block: "<title pos> <end pos> <is index complete>
+    // <num LDRs> <num data records> <num blocks>", followed by one line per
+    // LDR and data record: "<pos> <label length> <label>", followed by the
+    // nested blocks
+    indexStream << static_cast<std::streamoff>(m_titlePos) << ' '
+                << static_cast<std::streamoff>(m_endPos) << ' '
+                << (m_isLdrIndexComplete ? 1 : 0) << ' ' << m_ldrIndex.size()
+                << ' ' << m_dataIndex.size() << ' ' << m_blocks.size() << '\n';
+    for (const auto* index : {&m_ldrIndex, &m_dataIndex})
+    {
+        for (const auto& [label, pos] : *index)
+        {
+            indexStream << static_cast<std::streamoff>(pos) << ' '
+                        << label.size() << ' ' << label << '\n';
+        }
+    }
+    for (const auto& block : m_blocks)
+    {
+        block.writeIndex(indexStream);
+    }
+}
+
+void libjdx::jdx::Block::readIndex(std::istream& indexStream)
 {
-    parseInput(title, nextLine);
+    const auto length = static_cast<std::streamoff>(m_reader.getLength());
+    auto readPos = [&indexStream, length]() {
+        std::streamoff pos = -1;
+        indexStream >> pos;
+        if (!indexStream || pos < 0 || pos > length)
+        {
+            throw std::runtime_error("Illegal position in block index.");
+        }
+        return std::streampos{pos};
+    };
+    m_titlePos = readPos();
+    m_endPos = readPos();
+    int isComplete = 0;
+    size_t numLdrs = 0;
+    size_t numDataRecords = 0;
+    size_t numBlocks = 0;
+    indexStream >> isComplete >> numLdrs >> numDataRecords >> numBlocks;
+    if (!indexStream)
+    {
+        throw std::runtime_error("Malformed block index.");
+    }
+    m_isLdrIndexComplete = isComplete != 0;
+    for (size_t i = 0; i < numLdrs + numDataRecords; ++i)
+    {
+        const auto pos = readPos();
+        size_t labelLength = 0;
+        indexStream >> labelLength;
+        if (!indexStream || labelLength > static_cast<size_t>(length))
+        {
+            throw std::runtime_error("Malformed block index.");
+        }
+        // skip separator
+        indexStream.get();
+        std::string label(labelLength, '\0');
+        indexStream.read(
+            label.data(), static_cast<std::streamsize>(labelLength));
+        if (!indexStream)
+        {
+            throw std::runtime_error("Malformed block index.");
+        }
+        auto& index = i < numLdrs ? m_ldrIndex : m_dataIndex;
+        index.emplace(std::move(label), pos);
+    }
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        m_blocks.push_back(Block(m_reader, indexStream));
+    }
 }
 
 std::optional<const libjdx::jdx::StringLdr> libjdx::jdx::Block::getLdr(
     const std::string& label) const
 {
-    return util::findLdr(m_ldrs, label);
+    const auto* ldr = findLdr(label);
+    if (ldr == nullptr)
+    {
+        return std::nullopt;
+    }
+    return *ldr;
+}
+
+const libjdx::jdx::StringLdr* libjdx::jdx::Block::findLdr(
+    const std::string& label) const
+{
+    const auto normalizedLabel = util::normalizeLdrLabel(label);
+    if (m_lazyParsing != nullptr)
+    {
+        // lazily parsed block => try to avoid parsing the whole block
+        auto it = m_ldrIndex.find(normalizedLabel);
+        if (it != m_ldrIndex.cend())
+        {
+            // parse once, later lookups return the same LDR
+            std::lock_guard<std::mutex> lock{m_lazyParsing->indexedLdrsMutex};
+            auto indexedIt = m_indexedLdrs.find(normalizedLabel);
+            if (indexedIt == m_indexedLdrs.cend())
+            {
+                auto ldr = parseLdrAt(it->second);
+                indexedIt
+                    = m_indexedLdrs.emplace(normalizedLabel, std::move(ldr))
+                          .first;
+            }
+            return &indexedIt->second;
+        }
+        if (m_isLdrIndexComplete)
+        {
+            return nullptr;
+        }
+    }
+    const auto& content = getContent();
+    auto it = content.ldrIndex.find(normalizedLabel);
+    if (it == content.ldrIndex.cend())
+    {
+        return nullptr;
+    }
+    return &content.ldrs.at(it->second);
 }
 
 const std::vector<libjdx::jdx::StringLdr>& libjdx::jdx::Block::getLdrs() const
 {
-    return m_ldrs;
+    return getContent().ldrs;
 }
 
 const std::vector<libjdx::jdx::Block>& libjdx::jdx::Block::getBlocks() const
@@ -65,59 +251,59 @@ const std::vector<libjdx::jdx::Block>& libjdx::jdx::Block::getBlocks() const
 
 const std::vector<std::string>& libjdx::jdx::Block::getLdrComments() const
 {
-    return m_ldrComments;
+    return getContent().ldrComments;
 }
 
 const std::optional<libjdx::jdx::XyData>& libjdx::jdx::Block::getXyData() const
 {
-    return m_xyData;
+    return getDataRecord("XYDATA", &Content::xyData);
 }
 
 const std::optional<libjdx::jdx::RaData>& libjdx::jdx::Block::getRaData() const
 {
-    return m_raData;
+    return getDataRecord("RADATA", &Content::raData);
 }
 
 const std::optional<libjdx::jdx::XyPoints>&
 libjdx::jdx::Block::getXyPoints() const
 {
-    return m_xyPoints;
+    return getDataRecord("XYPOINTS", &Content::xyPoints);
 }
 
 const std::optional<libjdx::jdx::PeakTable>&
 libjdx::jdx::Block::getPeakTable() const
 {
-    return m_peakTable;
+    return getDataRecord("PEAKTABLE", &Content::peakTable);
 }
 
 const std::optional<libjdx::jdx::PeakAssignments>&
 libjdx::jdx::Block::getPeakAssignments() const
 {
-    return m_peakAssignments;
+    return getDataRecord("PEAKASSIGNMENTS", &Content::peakAssignments);
 }
 
 const std::optional<libjdx::jdx::NTuples>&
 libjdx::jdx::Block::getNTuples() const
 {
-    return m_nTuples;
+    return getDataRecord("NTUPLES", &Content::nTuples);
 }
 
 const std::optional<libjdx::jdx::AuditTrail>&
 libjdx::jdx::Block::getAuditTrail() const
 {
-    return m_auditTrail;
+    return getDataRecord("AUDITTRAIL", &Content::auditTrail);
 }
 
 const std::vector<libjdx::jdx::BrukerSpecificParameters>&
 libjdx::jdx::Block::getBrukerSpecificParameters() const
 {
-    return m_brukerSpecificParameters;
+    return getContent().brukerSpecificParameters;
 }
 
 const std::vector<libjdx::jdx::BrukerRelaxSection>&
 libjdx::jdx::Block::getBrukerRelaxSections() const
 {
-    return m_brukerRelaxSections;
+    return getContent().brukerRelaxSections;
 }
 
 std::string libjdx::jdx::Block::parseFirstLine(const std::string& firstLine)
@@ -135,13 +321,199 @@ std::string libjdx::jdx::Block::parseFirstLine(const std::string& firstLine)
     return value;
 }
 
+void libjdx::jdx::Block::parse(
+    const std::string& titleValue, const ParseOptions& options)
+{
+    if (options.lazy)
+    {
+        m_lazyParsing = std::make_unique<LazyParsing>();
+        scanInput();
+        return;
+    }
+#ifndef __EMSCRIPTEN__
+    // parallel parsing requires a reader per thread
+    if (options.numThreads != 1 && m_reader.canCreateCursor())
+    {
+        parseInParallel(titleValue, options.numThreads);
+        return;
+    }
+#endif
+    std::optional<std::string> nextLine;
+    parseInput(titleValue, m_reader, nextLine, m_content.emplace(), &m_blocks);
+}
+
+void libjdx::jdx::Block::parseInParallel(
+    const std::string& titleValue, size_t numThreads)
+{
+    const auto secondLinePos = m_reader.tellg();
+    try
+    {
+        // phase 1: find the boundaries of nested blocks
+        scanInput();
+        m_ldrIndex.clear();
+        // phase 2: parse nested blocks in parallel, each on its own cursor
+        std::vector<std::optional<Block>> blocks(m_blocks.size());
+        auto& pool = util::ThreadPool::getInstance();
+        const auto maxThreads
+            = numThreads == 0 ? pool.getNumThreads() : numThreads;
+        pool.forEach(
+            blocks.size(), maxThreads, [this, &blocks](size_t index) {
+                const auto& scannedBlock = m_blocks.at(index);
+                blocks.at(index).emplace(Block(m_reader.createCursor(),
+                    scannedBlock.m_titlePos, scannedBlock.m_endPos));
+            });
+        m_blocks.clear();
+        for (auto& block : blocks)
+        {
+            m_blocks.push_back(std::move(block.value()));
+        }
+        // parse the block's own content, skipping the nested blocks
+        m_reader.seekg(secondLinePos);
+        std::optional<std::string> nextLine;
+        parseInput(
+            titleValue, m_reader, nextLine, m_content.emplace(), nullptr);
+    }
+    catch (...)
+    {
+        // parse sequentially to report the same error as sequential parsing
+        m_blocks.clear();
+        m_ldrIndex.clear();
+        m_content.reset();
+        m_reader.seekg(secondLinePos);
+        std::optional<std::string> nextLine;
+        parseInput(
+            titleValue, m_reader, nextLine, m_content.emplace(), &m_blocks);
+    }
+}
+
+void libjdx::jdx::Block::scanInput()
+{
+    // only look at LDR starts to find the boundaries of nested blocks and the
+    // positions of regular LDRs
+    m_ldrIndex.emplace(s_blockStartLabel, m_titlePos);
+    bool isIndexing = true;
+    while (!m_reader.eof())
+    {
+        const auto pos = m_reader.tellg();
+        const auto line = m_reader.readLineView();
+        if (isIndexing && util::isBrukerSpecificSectionStart(line))
+        {
+            // Bruker sections contain LDRs that are not part of the block
+            isIndexing = false;
+            continue;
+        }
+        if (!util::isLdrStart(line))
+        {
+            continue;
+        }
+        const auto label = util::parseLdrStart(std::string{line}).first;
+        if ("END" == label)
+        {
+            m_endPos = m_reader.tellg();
+            m_isLdrIndexComplete = isIndexing;
+            return;
+        }
+        if (s_blockStartLabel == label)
+        {
+            // nested block, reader is moved past its END line
+            m_blocks.push_back(Block(m_reader, pos));
+            continue;
+        }
+        if (std::any_of(s_dataRecordLabels.cbegin(), s_dataRecordLabels.cend(),
+                [&label](const char* dataRecordLabel) {
+                    return label == dataRecordLabel;
+                }))
+        {
+            // only the first occurrence is indexed
+            m_dataIndex.emplace(label, pos);
+            isIndexing = false;
+            continue;
+        }
+        if (!isIndexing || label.empty())
+        {
+            // comment "##=" or not indexed
+            continue;
+        }
+        if ("$RELAX" == label)
+        {
+            // Bruker relax section, not parsed as a regular LDR
+            isIndexing = false;
+            continue;
+        }
+        // only the first occurrence is indexed
+        m_ldrIndex.emplace(label, pos);
+    }
+    throw BlockParseException(
+        "No", "END", std::string{parseLdrAt(m_titlePos).getValueView()});
+}
+
+void libjdx::jdx::Block::addStringLdr(
+    Content& content, std::string_view label, std::string_view value) const
+{
+    content.ldrs.emplace_back(label, value, m_arena.get());
+    // only the first occurrence is indexed, just like findLdr() would find it
+    content.ldrIndex.emplace(label, content.ldrs.size() - 1);
+}
+
+const libjdx::jdx::Block::Content& libjdx::jdx::Block::getContent() const
+{
+    if (m_lazyParsing != nullptr)
+    {
+        // lazily parsed block, parsed once on first access
+        std::call_once(m_lazyParsing->contentParsed, [this]() {
+            if (m_reader.canCreateCursor())
+            {
+                // parse through a separate cursor that the records refer to
+                auto cursor = m_reader.createCursor();
+                m_content.emplace(parseContent(*cursor));
+                m_lazyParsing->contentReader = std::move(cursor);
+                return;
+            }
+            auto parse = [this]() { return parseContent(m_reader); };
+            m_content.emplace(
+                util::callAndResetStreamPos<Content>(m_reader, parse));
+        });
+    }
+    return m_content.value();
+}
+
+libjdx::jdx::Block::Content libjdx::jdx::Block::parseContent(
+    io::TextReader& reader) const
+{
+    reader.seekg(m_titlePos);
+    auto titleFirstLine = parseFirstLine(reader.readLine());
+    std::optional<std::string> nextLine;
+    Content content;
+    parseInput(titleFirstLine, reader, nextLine, content, nullptr);
+    return content;
+}
+
+libjdx::jdx::StringLdr libjdx::jdx::Block::parseLdrAt(std::streampos pos) const
+{
+    auto parse = [this, pos](io::TextReader& reader) {
+        reader.seekg(pos);
+        auto [label, value] = util::parseLdrStart(reader.readLine());
+        parseStringValue(value, reader);
+        return StringLdr{label, value, m_arena.get()};
+    };
+    if (m_reader.canCreateCursor())
+    {
+        auto cursor = m_reader.createCursor();
+        return parse(*cursor);
+    }
+    return util::callAndResetStreamPos<StringLdr>(
+        m_reader, [this, &parse]() { return parse(m_reader); });
+}
+
 // NOLINTBEGIN(readability-function-cognitive-complexity)
-void libjdx::jdx::Block::parseInput(
-    const std::string& titleValue, std::optional<std::string>& nextLine)
+void libjdx::jdx::Block::parseInput(const std::string& titleValue,
+    io::TextReader& reader, std::optional<std::string>& nextLine,
+    Content& content, std::vector<Block>* blocks) const
 {
     std::string title = titleValue;
-    nextLine = parseStringValue(title, m_reader);
-    m_ldrs.emplace_back(s_blockStartLabel, title);
+    nextLine = parseStringValue(title, reader);
+    addStringLdr(content, s_blockStartLabel, title);
+    size_t numBlocks = 0;
 
     while (nextLine.has_value())
     {
@@ -150,10 +522,11 @@ void libjdx::jdx::Block::parseInput(
             // check for Bruker quirk
             if (util::isBrukerSpecificSectionStart(nextLine.value()))
             {
-                m_brukerSpecificParameters.emplace_back(m_reader, nextLine);
+                content.brukerSpecificParameters.emplace_back(
+                    reader, nextLine, m_arena.get());
                 continue;
             }
-            util::skipPureComments(m_reader, nextLine, true);
+            util::skipPureComments(reader, nextLine, true);
             continue;
         }
         // "auto [label, value] = util::parseLdrStart(nextLine.value());" cannot
@@ -166,8 +539,8 @@ void libjdx::jdx::Block::parseInput(
         if (label.empty())
         {
             // LDR start is an LDR comment "##="
-            nextLine = parseStringValue(value, m_reader);
-            m_ldrComments.push_back(value);
+            nextLine = parseStringValue(value, reader);
+            content.ldrComments.push_back(value);
         }
         else if ("END" == label)
         {
@@ -177,85 +550,94 @@ void libjdx::jdx::Block::parseInput(
         else if (s_blockStartLabel == label)
         {
             // nested block
-            auto block = Block(value, m_reader, nextLine);
-            m_blocks.push_back(std::move(block));
+            if (blocks == nullptr)
+            {
+                // already scanned => skip
+                reader.seekg(m_blocks.at(numBlocks++).m_endPos);
+                nextLine = reader.eof()
+                               ? std::nullopt
+                               : std::optional<std::string>{reader.readLine()};
+                continue;
+            }
+            auto block = Block(value, reader, nextLine);
+            blocks->push_back(std::move(block));
         }
         else if ("XYDATA" == label)
         {
-            addLdr<XyData>(title, "XYDATA", m_xyData, [&]() {
-                return XyData(label, value, m_ldrs, m_reader, nextLine);
+            addLdr<XyData>(title, "XYDATA", content.xyData, [&]() {
+                return XyData(label, value, content.ldrs, reader, nextLine);
             });
         }
         else if ("RADATA" == label)
         {
-            addLdr<RaData>(title, "RADATA", m_raData, [&]() {
-                return RaData(label, value, m_ldrs, m_reader, nextLine);
+            addLdr<RaData>(title, "RADATA", content.raData, [&]() {
+                return RaData(label, value, content.ldrs, reader, nextLine);
             });
         }
         else if ("XYPOINTS" == label)
         {
-            addLdr<XyPoints>(title, "XYPOINTS", m_xyPoints, [&]() {
-                return XyPoints(label, value, m_ldrs, m_reader, nextLine);
+            addLdr<XyPoints>(title, "XYPOINTS", content.xyPoints, [&]() {
+                return XyPoints(label, value, content.ldrs, reader, nextLine);
             });
         }
         else if ("PEAKTABLE" == label)
         {
-            addLdr<PeakTable>(title, "PEAKTABLE", m_peakTable,
-                [&]() { return PeakTable(label, value, m_reader, nextLine); });
+            addLdr<PeakTable>(title, "PEAKTABLE", content.peakTable,
+                [&]() { return PeakTable(label, value, reader, nextLine); });
         }
         else if ("PEAKASSIGNMENTS" == label)
         {
             addLdr<PeakAssignments>(
-                title, "PEAKASSIGNMENTS", m_peakAssignments, [&]() {
-                    return PeakAssignments(label, value, m_reader, nextLine);
+                title, "PEAKASSIGNMENTS", content.peakAssignments, [&]() {
+                    return PeakAssignments(label, value, reader, nextLine);
                 });
         }
         else if ("NTUPLES" == label)
         {
-            addLdr<NTuples>(title, "NTUPLES", m_nTuples, [&]() {
-                return NTuples(label, value, m_ldrs, m_reader, nextLine);
+            addLdr<NTuples>(title, "NTUPLES", content.nTuples, [&]() {
+                return NTuples(label, value, content.ldrs, reader, nextLine,
+                    m_arena.get());
             });
         }
         else if ("AUDITTRAIL" == label)
         {
-            addLdr<AuditTrail>(title, "AUDITTRAIL", m_auditTrail,
-                [&]() { return AuditTrail(label, value, m_reader, nextLine); });
+            addLdr<AuditTrail>(title, "AUDITTRAIL", content.auditTrail,
+                [&]() { return AuditTrail(label, value, reader, nextLine); });
         }
         else if ("$RELAX" == label)
         {
             // RELAX section start
             auto relaxSection
-                = BrukerRelaxSection(label, value, m_reader, nextLine);
+                = BrukerRelaxSection(label, value, reader, nextLine);
             // only add non blank sections
             // section may be blank if ##$RELAX= line is immediately followed by
             // $$ Bruker specific parameters
             if (!relaxSection.getName().empty()
                 || !relaxSection.getContent().empty())
             {
-                m_brukerRelaxSections.push_back(std::move(relaxSection));
+                content.brukerRelaxSections.push_back(std::move(relaxSection));
             }
         }
         else
         {
             // LDR is a regular LDR
-            nextLine = parseStringValue(value, m_reader);
+            nextLine = parseStringValue(value, reader);
             // duplicate?
-            std::optional<StringLdr> existingLdr = getLdr(label);
-            if (existingLdr)
+            auto it = content.ldrIndex.find(label);
+            if (it != content.ldrIndex.cend())
             {
                 // reference implementation seems to overwrite LDR with
                 // duplicate, but spec (JCAMP-DX IR 3.2) says
                 // a duplicate LDR is illegal in a block
                 // => accept if content is identical
-                if (existingLdr.has_value()
-                    && existingLdr.value().getValue() != value)
+                if (content.ldrs.at(it->second).getValueView() != value)
                 {
                     throw BlockParseException(
                         "Multiple non-identical values found for \"" + label
                         + std::string{"\" in block: \"" + title + "\""});
                 }
             }
-            m_ldrs.emplace_back(label, value);
+            addStringLdr(content, label, value);
         }
     }
 
@@ -265,7 +647,7 @@ void libjdx::jdx::Block::parseInput(
         throw BlockParseException("No", "END", title);
     }
     // make nextline the one following the ##END= LDR
-    nextLine = m_reader.eof() ? std::nullopt
-                              : std::optional<std::string>{m_reader.readLine()};
+    nextLine = reader.eof() ? std::nullopt
+                            : std::optional<std::string>{reader.readLine()};
 }
 // NOLINTEND(readability-function-cognitive-complexity)
\ No newline at end of file
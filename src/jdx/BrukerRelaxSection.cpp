@@ -91,11 +91,21 @@ void libjdx::jdx::BrukerRelaxSection::parse(
 }
 
 std::string libjdx::jdx::BrukerRelaxSection::getName() const
+{
+    return std::string{getNameView()};
+}
+
+std::string_view libjdx::jdx::BrukerRelaxSection::getNameView() const
 {
     return m_name;
 }
 
 std::string libjdx::jdx::BrukerRelaxSection::getContent() const
+{
+    return std::string{getContentView()};
+}
+
+std::string_view libjdx::jdx::BrukerRelaxSection::getContentView() const
 {
     return m_content;
 }
@@ -20,13 +20,14 @@
 #include "util/LdrUtils.hpp"
 
 libjdx::jdx::BrukerSpecificParameters::BrukerSpecificParameters(
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+    io::TextReader& reader, std::optional<std::string>& nextLine,
+    std::pmr::memory_resource* resource)
 {
-    parse(reader, nextLine);
+    parse(reader, nextLine, resource);
 }
 
-void libjdx::jdx::BrukerSpecificParameters::parse(
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+void libjdx::jdx::BrukerSpecificParameters::parse(io::TextReader& reader,
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource)
 {
     if (!nextLine.has_value()
         || !util::isBrukerSpecificSectionStart(nextLine.value()))
@@ -52,7 +53,7 @@ void libjdx::jdx::BrukerSpecificParameters::parse(
     }
     nextLine = reader.eof() ? std::optional<std::string>{} : reader.readLine();
 
-    parseLdrs(reader, nextLine);
+    parseLdrs(reader, nextLine, resource);
 }
 
 bool libjdx::jdx::BrukerSpecificParameters::isDashedLine(
@@ -71,8 +72,8 @@ bool libjdx::jdx::BrukerSpecificParameters::isDashedLine(
     return false;
 }
 
-void libjdx::jdx::BrukerSpecificParameters::parseLdrs(
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+void libjdx::jdx::BrukerSpecificParameters::parseLdrs(io::TextReader& reader,
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource)
 {
     while (nextLine.has_value()
            && !util::isBrukerSpecificSectionStart(nextLine.value())
@@ -81,7 +82,7 @@ void libjdx::jdx::BrukerSpecificParameters::parseLdrs(
         // TODO: skip other leading comments?
         auto [label, value] = util::parseLdrStart(nextLine.value());
         nextLine = parseStringValue(value, reader);
-        m_content.emplace_back(label, value);
+        m_content.emplace_back(label, value, resource);
     }
 
     if (!nextLine.has_value()
@@ -109,12 +110,23 @@ void libjdx::jdx::BrukerSpecificParameters::parseLdrs(
 }
 
 std::string libjdx::jdx::BrukerSpecificParameters::getName() const
+{
+    return std::string{getNameView()};
+}
+
+std::string_view libjdx::jdx::BrukerSpecificParameters::getNameView() const
 {
     return m_name;
 }
 
 std::vector<libjdx::jdx::StringLdr>
 libjdx::jdx::BrukerSpecificParameters::getContent() const
+{
+    return getLdrs();
+}
+
+const std::vector<libjdx::jdx::StringLdr>&
+libjdx::jdx::BrukerSpecificParameters::getLdrs() const
 {
     return m_content;
 }
@@ -16,10 +16,13 @@
  * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "jdx/Data2D.hpp"
+#include "jdx/DecodeCache.hpp"
+#include "jdx/ParallelDecoding.hpp"
 #include "jdx/ParseException.hpp"
 #include "util/DataParser.hpp"
 #include "util/LdrUtils.hpp"
 
+#include <stdexcept>
 #include <tuple>
 
 libjdx::jdx::Data2D::Data2D(
@@ -28,68 +31,162 @@ libjdx::jdx::Data2D::Data2D(
 {
 }
 
-std::vector<std::pair<double, double>> libjdx::jdx::Data2D::parseXppYYData(
-    const std::string& label, io::TextReader& reader, double firstX,
-    double lastX, double yFactor, uint64_t nPoints) const
+libjdx::jdx::Spectrum libjdx::jdx::Data2D::parseXppYYData(
+    std::string_view label, double firstX, double lastX, double yFactor,
+    uint64_t nPoints) const
+{
+    return getCachedSpectrum([&]() {
+        auto func = [&](io::TextReader& dataReader) {
+            return readXppYYSpectrum(
+                label, dataReader, firstX, lastX, yFactor, nPoints);
+        };
+        return readData<Spectrum>(func);
+    });
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::Data2D::parseXyXyData(
+    std::string_view label, double xFactor, double yFactor,
+    std::optional<size_t> nPoints) const
+{
+    return getCachedSpectrum([&]() {
+        auto func = [&](io::TextReader& dataReader) {
+            return readXyXySpectrum(
+                label, dataReader, xFactor, yFactor, nPoints);
+        };
+        return readData<Spectrum>(func);
+    });
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::Data2D::readXppYYSpectrum(
+    std::string_view label, io::TextReader& reader, double firstX,
+    double lastX, double yFactor, uint64_t nPoints)
 {
     // parse
-    auto func = [&]() {
-        return libjdx::jdx::util::DataParser::readXppYYData(reader);
-    };
-    auto yData = callAndResetStreamPos<std::vector<double>>(func);
+    // y values are scaled by the parser in a single pass
+    auto yData = libjdx::jdx::util::DataParser::readXppYYData(
+        reader, yFactor, ParallelDecoding::getNumThreads());
+
+    checkNumPoints(label, nPoints, yData.size());
+    // x values are implied by firstX, lastX and nPoints
+    // TODO: check if parsed data matches firstX, lastX
+    return Spectrum{firstX, lastX, std::move(yData)};
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::Data2D::readXyXySpectrum(
+    std::string_view label, io::TextReader& reader, double xFactor,
+    double yFactor, std::optional<size_t> nPoints)
+{
+    // parse
+    // x and y values are scaled by the parser in a single pass
+    auto xyData = libjdx::jdx::util::DataParser::readXyXyData(
+        reader, xFactor, yFactor);
 
-    if (yData.size() != nPoints)
+    if (nPoints.has_value())
     {
-        throw ParseException(
-            "Mismatch between NPOINTS and actual number of points in \"" + label
-            + "\". NPOINTS: " + std::to_string(nPoints)
-            + ", actual: " + std::to_string(yData.size()));
+        checkNumPoints(label, nPoints.value(), xyData.first.size());
     }
-    // prepare processing
-    std::vector<std::pair<double, double>> xyData{};
-    xyData.reserve(yData.size());
-    // cover special cases nPoints == 0 and nPoints == 1
-    if (nPoints == 0)
+    return Spectrum{std::move(xyData.first), std::move(xyData.second)};
+}
+
+size_t libjdx::jdx::Data2D::decodeXppYYData(std::string_view label,
+    double firstX, double lastX, double yFactor, uint64_t nPoints, double* x,
+    double* y, size_t size) const
+{
+    checkBufferSize(label, y, size, nPoints);
+    // parse
+    // y values are scaled by the parser and written to the buffer directly
+    auto func = [&](io::TextReader& dataReader) {
+        return libjdx::jdx::util::DataParser::readXppYYData(
+            dataReader, yFactor, y, size, ParallelDecoding::getNumThreads());
+    };
+    auto count = readData<size_t>(func);
+    checkNumPoints(label, nPoints, count);
+    if (x != nullptr)
     {
-        return xyData;
+        // same x values as for Spectrum with implicit x axis
+        const auto xIncrement
+            = Spectrum::computeXIncrement(firstX, lastX, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            x[i] = firstX + xIncrement * static_cast<double>(i);
+        }
     }
-    auto nominator = nPoints == 1 ? firstX : (lastX - firstX);
-    auto denominator = nPoints == 1 ? 1 : nPoints - 1;
-    // generate and return xy data
-    uint64_t count = 0;
-    for (auto yRaw : yData)
+    return count;
+}
+
+size_t libjdx::jdx::Data2D::decodeXyXyData(std::string_view label,
+    double xFactor, double yFactor, std::optional<size_t> nPoints, double* x,
+    double* y, size_t size) const
+{
+    checkBufferSize(label, y, size, nPoints);
+    // parse
+    // x and y values are scaled by the parser and written to the buffers
+    // directly
+    auto func = [&](io::TextReader& dataReader) {
+        return libjdx::jdx::util::DataParser::readXyXyData(
+            dataReader, xFactor, yFactor, x, y, size);
+    };
+    auto count = readData<size_t>(func);
+    if (nPoints.has_value())
     {
-        auto x = firstX
-                 + nominator / static_cast<double>(denominator)
-                       * static_cast<double>(count++);
-        auto y = yFactor * yRaw;
-        xyData.emplace_back(x, y);
+        checkNumPoints(label, nPoints.value(), count);
     }
-    // TODO: check if parsed data matches firstX, lastX
-    return xyData;
+    else if (count > size)
+    {
+        throw std::invalid_argument(
+            "Buffer too small for data in \"" + std::string{label}
+            + "\". Size: " + std::to_string(size)
+            + ", required: " + std::to_string(count));
+    }
+    return count;
 }
 
-std::vector<std::pair<double, double>> libjdx::jdx::Data2D::parseXyXyData(
-    const std::string& label, io::TextReader& reader, double xFactor,
-    double yFactor, std::optional<size_t> nPoints) const
+libjdx::jdx::Spectrum libjdx::jdx::Data2D::getCachedSpectrum(
+    const std::function<Spectrum()>& decode) const
 {
-    // parse
-    auto func
-        = [&]() { return libjdx::jdx::util::DataParser::readXyXyData(reader); };
-    auto xyData
-        = callAndResetStreamPos<std::vector<std::pair<double, double>>>(func);
+    auto& cache = DecodeCache::getInstance();
+    if (cache.getMemoryBudget() == 0)
+    {
+        // cache disabled
+        return decode();
+    }
+    auto cached = cache.find(getCacheKey());
+    if (cached.has_value())
+    {
+        return std::move(cached).value();
+    }
+    auto spectrum = decode();
+    cache.insert(getCacheKey(), spectrum);
+    return spectrum;
+}
 
-    if (nPoints.has_value() && xyData.size() != nPoints.value())
+void libjdx::jdx::Data2D::checkBufferSize(std::string_view label,
+    const double* y, size_t size, std::optional<uint64_t> nPoints)
+{
+    if (size > 0 && y == nullptr)
     {
-        throw ParseException(
-            "Mismatch between NPOINTS and actual number of points in \"" + label
-            + "\". NPOINTS: " + std::to_string(nPoints.value())
-            + ", actual: " + std::to_string(xyData.size()));
+        throw std::invalid_argument(
+            "Missing buffer for y values of \"" + std::string{label} + "\".");
+    }
+    if (nPoints.has_value() && nPoints.value() > size)
+    {
+        throw std::invalid_argument(
+            "Buffer too small for data in \"" + std::string{label}
+            + "\". Size: " + std::to_string(size)
+            + ", required: " + std::to_string(nPoints.value()));
     }
-    for (auto& pair : xyData)
+}
+
+void libjdx::jdx::Data2D::checkNumPoints(
+    std::string_view label, uint64_t nPoints, size_t actual)
+{
+    if (actual != nPoints)
     {
-        pair.first *= xFactor;
-        pair.second *= yFactor;
+        throw ParseException(
+            "Mismatch between NPOINTS and actual number of points in \""
+            + std::string{label}
+            + "\". NPOINTS: " + std::to_string(nPoints)
+            + ", actual: " + std::to_string(actual));
     }
-    return xyData;
 }
@@ -16,6 +16,7 @@
  * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "jdx/DataLdr.hpp"
+#include "jdx/DecodeCache.hpp"
 #include "jdx/ParseException.hpp"
 #include "util/LdrUtils.hpp"
 #include "util/StringUtils.hpp"
@@ -25,7 +26,9 @@ libjdx::jdx::DataLdr::DataLdr(
     : Ldr{std::move(label)}
     , m_variableList{std::move(variableList)}
     , m_reader{reader}
+    , m_source{reader.canCreateCursor() ? reader.createCursor() : nullptr}
     , m_dataPos{reader.tellg()}
+    , m_cacheKey{createCacheKey()}
 {
 }
 
@@ -39,21 +42,44 @@ libjdx::io::TextReader& libjdx::jdx::DataLdr::getReader() const
     return m_reader;
 }
 
-void libjdx::jdx::DataLdr::validateInput(const std::string& label,
+std::streampos libjdx::jdx::DataLdr::getDataPos() const
+{
+    return m_dataPos;
+}
+
+uint64_t libjdx::jdx::DataLdr::getCacheKey() const
+{
+    return *m_cacheKey;
+}
+
+std::shared_ptr<const uint64_t> libjdx::jdx::DataLdr::createCacheKey()
+{
+    // remove decoded data from the cache once the last copy of the record
+    // sharing the key is gone
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    const auto* key = new uint64_t{DecodeCache::createKey()};
+    return std::shared_ptr<const uint64_t>{key, [](const uint64_t* ptr) {
+        DecodeCache::getInstance().erase(*ptr);
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        delete ptr;
+    }};
+}
+
+void libjdx::jdx::DataLdr::validateInput(std::string_view label,
     const std::string& variableList, const std::string& expectedLabel,
     const std::vector<std::string>& expectedVariableLists)
 {
     if (label != expectedLabel)
     {
         throw ParseException("Illegal label at " + expectedLabel
-                             + " start encountered: " + label);
+                             + " start encountered: " + std::string{label});
     }
     if (std::none_of(expectedVariableLists.begin(), expectedVariableLists.end(),
             [&variableList](const std::string& expectedVariableList) {
                 return variableList == expectedVariableList;
             }))
     {
-        throw ParseException("Illegal variable list for " + label
+        throw ParseException("Illegal variable list for " + std::string{label}
                              + " encountered: " + variableList);
     }
 }
@@ -19,9 +19,11 @@
 #include "jdx/ParseException.hpp"
 #include "util/DataParser.hpp"
 #include "util/LdrUtils.hpp"
+#include "util/NumberParser.hpp"
 #include "util/PeakTableParser.hpp"
 #include "util/StringUtils.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <tuple>
 
@@ -30,9 +32,19 @@ libjdx::jdx::DataTable::DataTable(std::string label, std::string variableList,
     const std::vector<StringLdr>& blockLdrs,
     const std::vector<NTuplesAttributes>& nTuplesAttributes,
     const std::vector<StringLdr>& pageLdrs, io::TextReader& reader,
-    std::optional<std::string>& nextLine)
+    std::optional<std::string>& nextLine, bool skipData)
     : Data2D(std::move(label), std::move(variableList), reader)
     , m_plotDescriptor{std::move(plotDescriptor)}
+{
+    // validate label
+    validateInput(getLabelView(), s_label, s_label, {s_label});
+    validateStart(getVariableList(), m_plotDescriptor);
+    // parse
+    parse(blockLdrs, nTuplesAttributes, pageLdrs, nextLine, skipData);
+}
+
+void libjdx::jdx::DataTable::validateStart(const std::string& variableList,
+    const std::optional<std::string>& plotDescriptor)
 {
     // extract permitted variable lists from mapping keys
     std::vector<std::string> permittedVarLists;
@@ -41,15 +53,23 @@ libjdx::jdx::DataTable::DataTable(std::string label, std::string variableList,
     {
         permittedVarLists.emplace_back(keyValuePair.first);
     }
-    // validate label and variable list
-    validateInput(getLabel(), getVariableList(), s_label, permittedVarLists);
+    // validate variable list
+    validateInput(s_label, variableList, s_label, permittedVarLists);
     // validate plot descriptor if present
-    if (m_plotDescriptor)
+    if (plotDescriptor)
     {
-        determinePlotDescriptor(m_plotDescriptor.value());
+        determinePlotDescriptor(plotDescriptor.value());
     }
-    // parse
-    parse(blockLdrs, nTuplesAttributes, pageLdrs, nextLine);
+}
+
+bool libjdx::jdx::DataTable::isMergedBlockLdr(std::string_view label)
+{
+    auto isMapped = [label](const MergedLdrMapping& mapping) {
+        return label == mapping.units.first || label == mapping.varDim.first
+               || std::any_of(mapping.doubles.cbegin(), mapping.doubles.cend(),
+                   [label](const auto& item) { return label == item.first; });
+    };
+    return isMapped(s_xMergedLdrMapping) || isMapped(s_yMergedLdrMapping);
 }
 
 const std::optional<std::string>&
@@ -65,6 +85,11 @@ libjdx::jdx::DataTable::getAttributes() const
 }
 
 std::vector<std::pair<double, double>> libjdx::jdx::DataTable::getData() const
+{
+    return getSpectrum().toPairs();
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::DataTable::getSpectrum() const
 {
     auto variableList = determineVariableList(getVariableList());
     auto dataTableParams = m_mergedAttributes;
@@ -76,7 +101,7 @@ std::vector<std::pair<double, double>> libjdx::jdx::DataTable::getData() const
         auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
         auto nPoints = dataTableParams.yAttributes.varDim;
         return Data2D::parseXyXyData(
-            getLabel(), getReader(), xFactor, yFactor, nPoints);
+            getLabelView(), xFactor, yFactor, nPoints);
     }
 
     auto firstX = dataTableParams.xAttributes.first.value();
@@ -84,13 +109,72 @@ std::vector<std::pair<double, double>> libjdx::jdx::DataTable::getData() const
     auto nPoints = dataTableParams.yAttributes.varDim.value();
     auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
     return Data2D::parseXppYYData(
-        getLabel(), getReader(), firstX, lastX, yFactor, nPoints);
+        getLabelView(), firstX, lastX, yFactor, nPoints);
+}
+
+size_t libjdx::jdx::DataTable::decodeInto(
+    double* x, double* y, size_t size) const
+{
+    auto variableList = determineVariableList(getVariableList());
+    const auto& dataTableParams = m_mergedAttributes;
+
+    if (variableList == VariableList::XYXY || variableList == VariableList::XRXR
+        || variableList == VariableList::XIXI)
+    {
+        auto xFactor = dataTableParams.xAttributes.factor.value_or(1.0);
+        auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
+        auto nPoints = dataTableParams.yAttributes.varDim;
+        return Data2D::decodeXyXyData(
+            getLabelView(), xFactor, yFactor, nPoints, x, y, size);
+    }
+
+    auto firstX = dataTableParams.xAttributes.first.value();
+    auto lastX = dataTableParams.xAttributes.last.value();
+    auto nPoints = dataTableParams.yAttributes.varDim.value();
+    auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
+    return Data2D::decodeXppYYData(
+        getLabelView(), firstX, lastX, yFactor, nPoints, x, y, size);
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::DataTable::readSpectrum(
+    io::TextReader& reader) const
+{
+    auto variableList = determineVariableList(getVariableList());
+    const auto& dataTableParams = m_mergedAttributes;
+    // a noop if the reader is already positioned at the data, otherwise skips
+    // the preceding PAGE and page LDR lines
+    reader.seekg(getDataPos());
+
+    if (variableList == VariableList::XYXY || variableList == VariableList::XRXR
+        || variableList == VariableList::XIXI)
+    {
+        auto xFactor = dataTableParams.xAttributes.factor.value_or(1.0);
+        auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
+        auto nPoints = dataTableParams.yAttributes.varDim;
+        return Data2D::readXyXySpectrum(
+            getLabelView(), reader, xFactor, yFactor, nPoints);
+    }
+
+    auto firstX = dataTableParams.xAttributes.first.value();
+    auto lastX = dataTableParams.xAttributes.last.value();
+    auto nPoints = dataTableParams.yAttributes.varDim.value();
+    auto yFactor = dataTableParams.yAttributes.factor.value_or(1.0);
+    return Data2D::readXppYYSpectrum(
+        getLabelView(), reader, firstX, lastX, yFactor, nPoints);
+}
+
+bool libjdx::jdx::DataTable::hasImplicitX() const
+{
+    auto variableList = determineVariableList(getVariableList());
+    return variableList != VariableList::XYXY
+           && variableList != VariableList::XRXR
+           && variableList != VariableList::XIXI;
 }
 
 void libjdx::jdx::DataTable::parse(const std::vector<StringLdr>& blockLdrs,
     const std::vector<NTuplesAttributes>& nTuplesVars,
     const std::vector<StringLdr>& pageLdrs,
-    std::optional<std::string>& nextLine)
+    std::optional<std::string>& nextLine, bool skipData)
 {
     auto variableList = parseDataTableVars().first;
 
@@ -160,8 +244,11 @@ void libjdx::jdx::DataTable::parse(const std::vector<StringLdr>& blockLdrs,
 
     m_mergedAttributes = {mergedXVars, mergedYVars};
 
-    auto& reader = getReader();
-    util::skipToNextLdr(reader, nextLine, true);
+    if (skipData)
+    {
+        auto& reader = getReader();
+        util::skipToNextLdr(reader, nextLine, true);
+    }
 }
 
 std::pair<libjdx::jdx::Data2D::VariableList,
@@ -199,59 +286,21 @@ libjdx::jdx::NTuplesAttributes libjdx::jdx::DataTable::mergeVars(
     auto outputVars = nTuplesVars;
     outputVars.applicationAttributes.clear();
 
-    if (std::any_of(s_xSymbols.begin(), s_xSymbols.end(),
-            [&nTuplesVars](
-                const std::string& s) { return s == nTuplesVars.symbol; }))
+    auto isSymbol = [&nTuplesVars](const std::string& symbol) {
+        return symbol == nTuplesVars.symbol;
+    };
+    const MergedLdrMapping* mapping = nullptr;
+    if (std::any_of(s_xSymbols.begin(), s_xSymbols.end(), isSymbol))
     {
         // use values from block relevant for abscissa
-        std::map<std::string, std::optional<std::string>&> stringMapping{
-            {"XUNITS", outputVars.units},
-        };
-        std::map<std::string, std::optional<double>&> doubleMapping{
-            {"FIRSTX", outputVars.first},
-            {"LASTX", outputVars.last},
-            {"MINX", outputVars.min},
-            {"MAXX", outputVars.max},
-            {"XFACTOR", outputVars.factor},
-        };
-        std::map<std::string, std::optional<uint64_t>&> uint64Mapping{
-            {"NPOINTS", outputVars.varDim},
-        };
-
-        // fill in block params for missing NTUPLE attributes
-        mergeLdrs(
-            blockLdrs, stringMapping, doubleMapping, uint64Mapping, false);
-
-        // replace with page LDR values if available
-        mergeLdrs(pageLdrs, stringMapping, doubleMapping, uint64Mapping, true);
+        mapping = &s_xMergedLdrMapping;
     }
-    else if (std::any_of(s_ySymbols.begin(), s_ySymbols.end(),
-                 [&nTuplesVars](
-                     const std::string& s) { return s == nTuplesVars.symbol; }))
+    else if (std::any_of(s_ySymbols.begin(), s_ySymbols.end(), isSymbol))
     {
         // use values from block relevant for ordinate
-        std::map<std::string, std::optional<std::string>&> stringMapping{
-            {"YUNITS", outputVars.units},
-        };
-        std::map<std::string, std::optional<double>&> doubleMapping{
-            {"FIRSTY", outputVars.first},
-            {"LASTY", outputVars.last},
-            {"MINY", outputVars.min},
-            {"MAXY", outputVars.max},
-            {"YFACTOR", outputVars.factor},
-        };
-        std::map<std::string, std::optional<uint64_t>&> uint64Mapping{
-            {"NPOINTS", outputVars.varDim},
-        };
         // Also check for other symbols but Y? Does not seem relevant for NMR
         // and MS.
-
-        // fill in block params for missing NTUPLE attributes
-        mergeLdrs(
-            blockLdrs, stringMapping, doubleMapping, uint64Mapping, false);
-
-        // replace with page LDR values if available
-        mergeLdrs(pageLdrs, stringMapping, doubleMapping, uint64Mapping, true);
+        mapping = &s_yMergedLdrMapping;
     }
     else
     {
@@ -259,6 +308,24 @@ libjdx::jdx::NTuplesAttributes libjdx::jdx::DataTable::mergeVars(
                              + nTuplesVars.symbol);
     }
 
+    std::map<std::string, std::optional<std::string>&> stringMapping{
+        {mapping->units.first, outputVars.*mapping->units.second},
+    };
+    std::map<std::string, std::optional<double>&> doubleMapping;
+    for (const auto& [label, attribute] : mapping->doubles)
+    {
+        doubleMapping.emplace(label, outputVars.*attribute);
+    }
+    std::map<std::string, std::optional<uint64_t>&> uint64Mapping{
+        {mapping->varDim.first, outputVars.*mapping->varDim.second},
+    };
+
+    // fill in block params for missing NTUPLE attributes
+    mergeLdrs(blockLdrs, stringMapping, doubleMapping, uint64Mapping, false);
+
+    // replace with page LDR values if available
+    mergeLdrs(pageLdrs, stringMapping, doubleMapping, uint64Mapping, true);
+
     return outputVars;
 }
 
@@ -269,28 +336,29 @@ void libjdx::jdx::DataTable::mergeLdrs(const std::vector<StringLdr>& ldrs,
 {
     for (const auto& ldr : ldrs)
     {
-        if (stringMapping.count(ldr.getLabel()) > 0)
+        const auto label = std::string{ldr.getLabelView()};
+        if (stringMapping.count(label) > 0)
         {
-            auto& field = stringMapping.at(ldr.getLabel());
+            auto& field = stringMapping.at(label);
             if (replace || !field || field.value().empty())
             {
-                field = ldr.getValue();
+                field = ldr.getValueView();
             }
         }
-        else if (doubleMapping.count(ldr.getLabel()) > 0)
+        else if (doubleMapping.count(label) > 0)
         {
-            auto& field = doubleMapping.at(ldr.getLabel());
+            auto& field = doubleMapping.at(label);
             if (replace || !field)
             {
-                field = std::stod(ldr.getValue());
+                field = util::toDouble(ldr.getValueView());
             }
         }
-        else if (uint64Mapping.count(ldr.getLabel()) > 0)
+        else if (uint64Mapping.count(label) > 0)
         {
-            auto& field = uint64Mapping.at(ldr.getLabel());
+            auto& field = uint64Mapping.at(label);
             if (replace || !field)
             {
-                field = std::stol(ldr.getValue());
+                field = util::toUInt64(ldr.getValueView());
             }
         }
     }
@@ -302,12 +370,12 @@ void libjdx::jdx::DataTable::mergePageFirstLdr(
 {
     for (const auto& ldr : pageLdrs)
     {
-        if ("FIRST" == ldr.getLabel())
+        if ("FIRST" == ldr.getLabelView())
         {
-            auto segments = util::split(ldr.getValue(), ",", true);
+            auto segments = util::split(ldr.getValueView(), ",", true);
             if (segments.size() > columnIndex)
             {
-                auto value = std::stod(segments.at(columnIndex));
+                auto value = util::toDouble(segments.at(columnIndex));
                 mergedVars.first = value;
             }
             break;
@@ -0,0 +1,134 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/DecodeCache.hpp"
+
+#include <atomic>
+
+libjdx::jdx::DecodeCache::DecodeCache()
+    : m_memoryBudget{0}
+    , m_memoryUsage{0}
+{
+}
+
+libjdx::jdx::DecodeCache& libjdx::jdx::DecodeCache::getInstance()
+{
+    // intentionally never destroyed so that data LDRs with static storage
+    // duration can still access the cache on destruction
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    static auto* instance = new DecodeCache{};
+    return *instance;
+}
+
+void libjdx::jdx::DecodeCache::setMemoryBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_memoryBudget = bytes;
+    evict(bytes);
+}
+
+size_t libjdx::jdx::DecodeCache::getMemoryBudget() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_memoryBudget;
+}
+
+size_t libjdx::jdx::DecodeCache::getMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_memoryUsage;
+}
+
+void libjdx::jdx::DecodeCache::clear()
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_entries.clear();
+    m_lru.clear();
+    m_memoryUsage = 0;
+}
+
+std::optional<libjdx::jdx::Spectrum> libjdx::jdx::DecodeCache::find(
+    uint64_t key)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return std::nullopt;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruPos);
+    return it->second.spectrum;
+}
+
+void libjdx::jdx::DecodeCache::insert(uint64_t key, const Spectrum& spectrum)
+{
+    const auto size = getSize(spectrum);
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        eraseEntry(it);
+    }
+    if (size > m_memoryBudget)
+    {
+        return;
+    }
+    evict(m_memoryBudget - size);
+    m_lru.push_front(key);
+    m_entries.emplace(key, Entry{spectrum, size, m_lru.begin()});
+    m_memoryUsage += size;
+}
+
+void libjdx::jdx::DecodeCache::erase(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        eraseEntry(it);
+    }
+}
+
+uint64_t libjdx::jdx::DecodeCache::createKey()
+{
+    static std::atomic<uint64_t> nextKey{0};
+    return nextKey++;
+}
+
+size_t libjdx::jdx::DecodeCache::getSize(const Spectrum& spectrum)
+{
+    return sizeof(Spectrum)
+           + (spectrum.getExplicitXValues().size()
+                 + spectrum.getYValues().size())
+                 * sizeof(double);
+}
+
+void libjdx::jdx::DecodeCache::eraseEntry(
+    std::unordered_map<uint64_t, Entry>::iterator it)
+{
+    m_memoryUsage -= it->second.size;
+    m_lru.erase(it->second.lruPos);
+    m_entries.erase(it);
+}
+
+void libjdx::jdx::DecodeCache::evict(size_t budget)
+{
+    while (m_memoryUsage > budget && !m_lru.empty())
+    {
+        eraseEntry(m_entries.find(m_lru.back()));
+    }
+}
@@ -42,6 +42,9 @@
 #endif
 
 #include "jdx/JdxParser.hpp"
+#include "io/BufferedTextReader.hpp"
+#include "io/MappedTextReader.hpp"
+#include "io/SimpleTextReader.hpp"
 #include "io/TextReader.hpp"
 #include "util/LdrUtils.hpp"
 #include "util/StringUtils.hpp"
@@ -50,7 +53,9 @@
 #include <array>
 #include <climits>
 #include <cstring>
+#include <fstream>
 #include <limits>
+#include <random>
 #include <sstream>
 // include and alias filesystem header
 #if JDX_USE_EXPERIMENTAL_FILESYSTEM
@@ -61,6 +66,14 @@ namespace fs = std::experimental::filesystem;
 namespace fs = std::filesystem;
 #endif
 
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/vfs.h>)
+#include <sys/vfs.h>
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_USE_STATFS 1
+#endif
+#endif
+
 bool libjdx::jdx::JdxParser::canParse(
     const std::string& filePath, std::istream& iStream)
 {
@@ -94,16 +107,187 @@ bool libjdx::jdx::JdxParser::canParse(
 }
 
 libjdx::jdx::Block libjdx::jdx::JdxParser::parse(
-    std::unique_ptr<std::istream> streamPtr)
+    std::unique_ptr<std::istream> streamPtr, const ParseOptions& options)
+{
+    auto textReaderPtr
+        = createTextReader(std::move(streamPtr), options.readerType);
+    libjdx::jdx::Block block{std::move(textReaderPtr), options};
+    return block;
+}
+
+libjdx::jdx::Block libjdx::jdx::JdxParser::parse(
+    const std::string& filePath, const ParseOptions& options)
 {
-    auto textReaderPtr = std::make_unique<io::TextReader>(std::move(streamPtr));
-    libjdx::jdx::Block block{std::move(textReaderPtr)};
+    if (options.lazy && options.useIndexFile)
+    {
+        return parseWithIndexFile(filePath, options);
+    }
+    auto textReaderPtr = createTextReader(filePath, options.readerType);
+    libjdx::jdx::Block block{std::move(textReaderPtr), options};
     return block;
 }
 
-libjdx::jdx::Block libjdx::jdx::JdxParser::parse(const std::string& filePath)
+libjdx::jdx::Block libjdx::jdx::JdxParser::parse(
+    std::shared_ptr<const std::vector<char>> buffer,
+    const ParseOptions& options)
 {
-    auto textReaderPtr = std::make_unique<io::TextReader>(filePath);
-    libjdx::jdx::Block block{std::move(textReaderPtr)};
+    auto textReaderPtr = std::make_unique<io::TextReader>(
+        std::make_unique<io::MappedTextReader>(std::move(buffer)));
+    libjdx::jdx::Block block{std::move(textReaderPtr), options};
+    return block;
+}
+
+libjdx::jdx::Block libjdx::jdx::JdxParser::parse(
+    const char* data, size_t size, const ParseOptions& options)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto buffer = std::make_shared<const std::vector<char>>(data, data + size);
+    return parse(std::move(buffer), options);
+}
+
+libjdx::jdx::Block libjdx::jdx::JdxParser::parseWithIndexFile(
+    const std::string& filePath, const ParseOptions& options)
+{
+    const auto indexFilePath = filePath + s_indexFileExtension;
+    // determine stamp before reading the data so that changes while reading
+    // render the index stale
+    const auto fileStamp = getFileStamp(filePath);
+    auto textReaderPtr = createTextReader(filePath, options.readerType);
+    std::ifstream indexStream{indexFilePath, std::ios::binary};
+    if (indexStream)
+    {
+        std::string magic;
+        int version = 0;
+        std::string indexStamp;
+        indexStream >> magic >> version;
+        // skip separator
+        indexStream.get();
+        std::getline(indexStream, indexStamp);
+        if (indexStream && magic == s_indexFileMagic
+            && version == s_indexFileVersion && indexStamp == fileStamp)
+        {
+            try
+            {
+                return Block{std::move(textReaderPtr), indexStream};
+            }
+            catch (const std::exception&)
+            {
+                // malformed index => scan
+                textReaderPtr = createTextReader(filePath, options.readerType);
+            }
+        }
+    }
+
+    Block block{std::move(textReaderPtr), options};
+    // write to a temporary file first so that concurrent readers never see a
+    // partially written index, the random suffix keeps concurrent writers,
+    // e.g., other processes opening the same file, from sharing that file
+    std::random_device randomDevice;
+    const auto tmpFilePath = indexFilePath + '.'
+                             + std::to_string(randomDevice())
+                             + std::to_string(randomDevice()) + ".tmp";
+    try
+    {
+        {
+            std::ofstream outStream{tmpFilePath, std::ios::binary};
+            outStream << s_indexFileMagic << ' ' << s_indexFileVersion << ' '
+                      << fileStamp << '\n';
+            block.writeIndex(outStream);
+            outStream.close();
+            if (!outStream)
+            {
+                throw std::runtime_error(
+                    "Could not write index file: " + tmpFilePath);
+            }
+        }
+        fs::rename(tmpFilePath, indexFilePath);
+    }
+    catch (const std::exception&)
+    {
+        // the index is an optimization only, e.g., the directory may not be
+        // writable
+        std::error_code errorCode;
+        fs::remove(tmpFilePath, errorCode);
+    }
     return block;
 }
+
+std::string libjdx::jdx::JdxParser::getFileStamp(const std::string& filePath)
+{
+    const auto size = fs::file_size(filePath);
+    const auto mtime = fs::last_write_time(filePath).time_since_epoch().count();
+    return std::to_string(size) + ' ' + std::to_string(mtime);
+}
+
+std::unique_ptr<libjdx::io::TextReader>
+libjdx::jdx::JdxParser::createTextReader(
+    std::unique_ptr<std::istream> streamPtr, io::TextReaderType type)
+{
+    switch (type)
+    {
+    case io::TextReaderType::Mapped:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::MappedTextReader>(std::move(streamPtr)));
+    case io::TextReaderType::Buffered:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::BufferedTextReader>(std::move(streamPtr)));
+    case io::TextReaderType::Simple:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::SimpleTextReader>(std::move(streamPtr)));
+    default:
+        return std::make_unique<io::TextReader>(std::move(streamPtr));
+    }
+}
+
+std::unique_ptr<libjdx::io::TextReader>
+libjdx::jdx::JdxParser::createTextReader(
+    const std::string& filePath, io::TextReaderType type)
+{
+    switch (type)
+    {
+    case io::TextReaderType::Mapped:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::MappedTextReader>(filePath));
+    case io::TextReaderType::Buffered:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::BufferedTextReader>(filePath));
+    case io::TextReaderType::Simple:
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::SimpleTextReader>(filePath));
+    default:
+        break;
+    }
+#ifndef __EMSCRIPTEN__
+    // page faults on a network file system are expensive and the file may
+    // change underneath the mapping => read large files in big chunks ahead
+    std::error_code errorCode;
+    const auto fileSize = fs::file_size(filePath, errorCode);
+    if (!errorCode && fileSize > s_networkMappedMaxSize
+        && isNetworkFileSystem(filePath))
+    {
+        return std::make_unique<io::TextReader>(
+            std::make_unique<io::BufferedTextReader>(
+                filePath, s_networkBufferSize, true));
+    }
+#endif
+    return std::make_unique<io::TextReader>(filePath);
+}
+
+bool libjdx::jdx::JdxParser::isNetworkFileSystem(const std::string& filePath)
+{
+#ifdef JDX_USE_STATFS
+    struct statfs fsStat
+    {
+    };
+    if (statfs(filePath.c_str(), &fsStat) != 0)
+    {
+        return false;
+    }
+    const auto type = static_cast<uint32_t>(fsStat.f_type);
+    return std::find(s_networkFileSystemTypes.cbegin(),
+               s_networkFileSystemTypes.cend(), type)
+           != s_networkFileSystemTypes.cend();
+#else
+    return false;
+#endif
+}
@@ -17,12 +17,18 @@
  */
 #include "jdx/Ldr.hpp"
 
-libjdx::jdx::Ldr::Ldr(std::string label)
-    : m_label{std::move(label)}
+libjdx::jdx::Ldr::Ldr(
+    std::string_view label, std::pmr::memory_resource* resource)
+    : m_label{label, resource}
 {
 }
 
-const std::string& libjdx::jdx::Ldr::getLabel() const
+std::string libjdx::jdx::Ldr::getLabel() const
+{
+    return std::string{m_label};
+}
+
+std::string_view libjdx::jdx::Ldr::getLabelView() const
 {
     return m_label;
 }
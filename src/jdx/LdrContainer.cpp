@@ -25,12 +25,12 @@ std::optional<const std::string> libjdx::jdx::LdrContainer::parseStringValue(
     util::trim(value); // trim first line value only
     while (!reader.eof())
     {
-        auto line = reader.readLine();
+        auto line = reader.readLineView();
         if (util::isLdrStart(line))
         {
-            return line;
+            return std::string{line};
         }
-        auto [content, comment] = util::stripLineComment(line);
+        auto [content, comment] = util::stripLineCommentView(line);
         if (!content.empty() && !value.empty() && value.back() == '=')
         {
             // account for terminal "=" as non line breaking marker
@@ -43,11 +43,12 @@ std::optional<const std::string> libjdx::jdx::LdrContainer::parseStringValue(
                  && (util::isBrukerSpecificSectionStart(line)
                      || util::isBrukerSpecificSectionEnd(line)))
         {
-            return line;
+            return std::string{line};
         }
         else
         {
-            value.append('\n' + line);
+            value += '\n';
+            value.append(line);
         }
     }
     return std::nullopt;
@@ -18,20 +18,30 @@
 #include "jdx/NTuples.hpp"
 #include "jdx/ParseException.hpp"
 #include "util/LdrUtils.hpp"
+#include "util/NumberParser.hpp"
 #include "util/StringUtils.hpp"
+#include "util/ThreadPool.hpp"
 
 #include <utility>
 
 libjdx::jdx::NTuples::NTuples(const std::string& label, std::string dataForm,
     const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-    std::optional<std::string>& nextLine)
-    : m_dataForm{std::move(dataForm)}
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource)
+    : m_reader{reader}
+    , m_resource{resource}
+    , m_dataForm{std::move(dataForm)}
+    , m_pagesMutex{std::make_unique<std::mutex>()}
 {
     validateInput(label);
-    parse(blockLdrs, reader, nextLine);
+    parse(blockLdrs, reader, nextLine, resource);
 }
 
 std::string libjdx::jdx::NTuples::getDataForm() const
+{
+    return std::string{getDataFormView()};
+}
+
+std::string_view libjdx::jdx::NTuples::getDataFormView() const
 {
     return m_dataForm;
 }
@@ -49,12 +59,162 @@ libjdx::jdx::NTuples::getAttributes() const
 
 size_t libjdx::jdx::NTuples::getNumPages() const
 {
-    return m_pages.size();
+    return m_pageOffsets.size();
 }
 
 const libjdx::jdx::Page& libjdx::jdx::NTuples::getPage(size_t pageIndex) const
 {
-    return m_pages.at(pageIndex);
+    const auto* parsedPage = findPage(pageIndex);
+    if (parsedPage != nullptr)
+    {
+        return *parsedPage;
+    }
+    if (!m_reader.canCreateCursor())
+    {
+        // parsing moves the shared reader
+        std::lock_guard<std::mutex> lock{*m_pagesMutex};
+        auto& page = m_pages.at(pageIndex);
+        if (!page)
+        {
+            auto parse = [this, pageIndex]() {
+                return parsePage(m_reader, pageIndex);
+            };
+            page.emplace(util::callAndResetStreamPos<Page>(m_reader, parse));
+        }
+        return page.value();
+    }
+    // parse through a separate cursor without holding the lock
+    auto cursor = m_reader.createCursor();
+    return publishPage(pageIndex, parsePage(*cursor, pageIndex));
+}
+
+const libjdx::jdx::Page* libjdx::jdx::NTuples::findPage(size_t pageIndex) const
+{
+    std::lock_guard<std::mutex> lock{*m_pagesMutex};
+    const auto& page = m_pages.at(pageIndex);
+    return page.has_value() ? &page.value() : nullptr;
+}
+
+const libjdx::jdx::Page& libjdx::jdx::NTuples::publishPage(
+    size_t pageIndex, Page page) const
+{
+    std::lock_guard<std::mutex> lock{*m_pagesMutex};
+    auto& publishedPage = m_pages.at(pageIndex);
+    if (!publishedPage)
+    {
+        // the first page parsed wins, concurrently parsed pages are identical
+        publishedPage.emplace(std::move(page));
+    }
+    return publishedPage.value();
+}
+
+libjdx::jdx::Page libjdx::jdx::NTuples::parsePage(
+    io::TextReader& reader, size_t pageIndex, bool skipData) const
+{
+    const auto& pageOffset = m_pageOffsets.at(pageIndex);
+    reader.seekg(pageOffset.position);
+    std::optional<std::string> nextLine
+        = reader.eof() ? std::nullopt
+                       : std::optional<std::string>{reader.readLine()};
+    std::string label{"PAGE"};
+    return Page(label, pageOffset.pageVariables, m_attributes, m_blockLdrs,
+        reader, nextLine, m_resource, skipData);
+}
+
+libjdx::jdx::NTuples::Matrix libjdx::jdx::NTuples::decodeMatrix(
+    [[maybe_unused]] size_t numThreads) const
+{
+    // parse all pages upfront
+    std::vector<const DataTable*> dataTables;
+    Matrix matrix;
+    for (size_t i = 0; i < getNumPages(); ++i)
+    {
+        const auto& page = getPage(i);
+        const auto& dataTable = page.getDataTable();
+        if (!dataTable.has_value() || !dataTable.value().hasImplicitX())
+        {
+            throw ParseException("No equidistant DATA TABLE found in NTUPLES "
+                                 "PAGE: "
+                                 + page.getPageVariables());
+        }
+        const auto& attributes = dataTable.value().getAttributes();
+        const auto& xAttributes = attributes.xAttributes;
+        const auto cols = attributes.yAttributes.varDim.value_or(0);
+        if (dataTables.empty())
+        {
+            matrix.cols = cols;
+            matrix.firstX = xAttributes.first.value_or(0.0);
+            matrix.lastX = xAttributes.last.value_or(0.0);
+            matrix.attributes = attributes;
+        }
+        else if (cols != matrix.cols
+                 || xAttributes.first.value_or(0.0) != matrix.firstX
+                 || xAttributes.last.value_or(0.0) != matrix.lastX)
+        {
+            throw ParseException(
+                "DATA TABLE x axis differs from first page in NTUPLES PAGE: "
+                + page.getPageVariables());
+        }
+        dataTables.push_back(&dataTable.value());
+        matrix.pageVariables.push_back(page.getPageVariables());
+    }
+    matrix.rows = dataTables.size();
+    matrix.values.resize(matrix.rows * matrix.cols);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#ifndef __EMSCRIPTEN__
+    if (m_reader.canCreateCursor())
+    {
+        auto& pool = util::ThreadPool::getInstance();
+        const auto maxThreads
+            = numThreads == 0 ? pool.getNumThreads() : numThreads;
+        auto decodeRow = [&dataTables, &matrix](size_t row) {
+            // each record decodes through its own cursor
+            dataTables.at(row)->decodeInto(nullptr,
+                matrix.values.data() + row * matrix.cols, matrix.cols);
+        };
+        pool.forEach(matrix.rows, maxThreads, decodeRow);
+        return matrix;
+    }
+#endif
+    for (size_t row = 0; row < matrix.rows; ++row)
+    {
+        dataTables.at(row)->decodeInto(nullptr,
+            matrix.values.data() + row * matrix.cols, matrix.cols);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return matrix;
+}
+
+void libjdx::jdx::NTuples::decodePages(
+    const std::function<void(size_t, const Page&, const Spectrum&)>& consume)
+    const
+{
+    auto sweep = [this, &consume](io::TextReader& reader) {
+        // pages follow each other, reading the data of a page leaves the
+        // reader at the start of the following page
+        for (size_t i = 0; i < m_pages.size(); ++i)
+        {
+            const auto* page = findPage(i);
+            if (page == nullptr)
+            {
+                // stop at the start of the data so that it is only read once
+                page = &publishPage(i, parsePage(reader, i, false));
+            }
+            const auto& dataTable = page->getDataTable();
+            consume(i, *page,
+                dataTable.has_value() ? dataTable.value().readSpectrum(reader)
+                                      : Spectrum{});
+        }
+    };
+    if (m_reader.canCreateCursor())
+    {
+        auto cursor = m_reader.createCursor();
+        sweep(*cursor);
+        return;
+    }
+    util::callAndResetStreamPos<void>(
+        m_reader, [this, &sweep]() { sweep(m_reader); });
 }
 
 void libjdx::jdx::NTuples::validateInput(const std::string& label)
@@ -67,15 +227,26 @@ void libjdx::jdx::NTuples::validateInput(const std::string& label)
 }
 
 void libjdx::jdx::NTuples::parse(const std::vector<StringLdr>& blockLdrs,
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+    io::TextReader& reader, std::optional<std::string>& nextLine,
+    std::pmr::memory_resource* resource)
 {
+    // only keep the block LDRs used by the pages, the block LDRs themselves
+    // may not outlive this record
+    for (const auto& ldr : blockLdrs)
+    {
+        if (DataTable::isMergedBlockLdr(ldr.getLabelView()))
+        {
+            m_blockLdrs.emplace_back(
+                ldr.getLabelView(), ldr.getValueView(), resource);
+        }
+    }
     // skip potential comment lines
     nextLine = reader.eof() ? std::nullopt
                             : std::optional<std::string>{reader.readLine()};
     util::skipPureComments(reader, nextLine, true);
     // parse PAGE parameters
-    m_attributes = parseAttributes(reader, nextLine);
-    // parse pages
+    m_attributes = parseAttributes(reader, nextLine, resource);
+    // record page positions, pages are parsed on demand
     while (nextLine.has_value() && util::isLdrStart(nextLine.value()))
     {
         auto [label, pageVar] = util::parseLdrStart(nextLine.value());
@@ -96,11 +267,14 @@ void libjdx::jdx::NTuples::parse(const std::vector<StringLdr>& blockLdrs,
             throw ParseException("Unexpected content found in NTUPLES record: "
                                  + nextLine.value());
         }
-        nextLine = reader.eof() ? std::nullopt
-                                : std::optional<std::string>{reader.readLine()};
-        auto page
-            = Page(label, pageVar, m_attributes, blockLdrs, reader, nextLine);
-        m_pages.push_back(std::move(page));
+        if (reader.eof())
+        {
+            nextLine = std::nullopt;
+            break;
+        }
+        m_pageOffsets.push_back({reader.tellg(), pageVar});
+        m_pages.emplace_back();
+        nextLine = scanPage(reader);
     }
     if (!nextLine.has_value())
     {
@@ -108,11 +282,43 @@ void libjdx::jdx::NTuples::parse(const std::vector<StringLdr>& blockLdrs,
     }
 }
 
+std::optional<std::string> libjdx::jdx::NTuples::scanPage(
+    io::TextReader& reader)
+{
+    // only validate the page structure, the content is parsed by Page
+    auto hasDataTable = false;
+    while (!reader.eof())
+    {
+        auto line = reader.readLineView();
+        if (!util::isLdrStart(line))
+        {
+            continue;
+        }
+        auto [label, value] = util::parseLdrStart(std::string{line});
+        if (label == "PAGE" || label == "ENDNTUPLES")
+        {
+            return std::string{line};
+        }
+        if (label == "END" || hasDataTable)
+        {
+            throw ParseException(
+                "Unexpected content found in NTUPLES record: "
+                + std::string{line});
+        }
+        if (label == "DATATABLE")
+        {
+            Page::validateDataTableStart(value);
+            hasDataTable = true;
+        }
+    }
+    return std::nullopt;
+}
+
 std::vector<libjdx::jdx::NTuplesAttributes>
-libjdx::jdx::NTuples::parseAttributes(
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+libjdx::jdx::NTuples::parseAttributes(io::TextReader& reader,
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource)
 {
-    m_ldrs = readLdrs(nextLine, reader);
+    m_ldrs = readLdrs(nextLine, reader, resource);
     auto attrMap = splitValues(m_ldrs);
     auto standardAttrMap = extractStandardAttributes(attrMap);
 
@@ -147,7 +353,8 @@ libjdx::jdx::NTuples::parseAttributes(
 }
 
 std::vector<libjdx::jdx::StringLdr> libjdx::jdx::NTuples::readLdrs(
-    std::optional<std::string>& firstLdrStart, io::TextReader& reader)
+    std::optional<std::string>& firstLdrStart, io::TextReader& reader,
+    std::pmr::memory_resource* resource)
 {
     std::optional<std::string>& nextLine = firstLdrStart;
     std::vector<StringLdr> output;
@@ -160,7 +367,7 @@ std::vector<libjdx::jdx::StringLdr> libjdx::jdx::NTuples::readLdrs(
             break;
         }
         nextLine = parseStringValue(value, reader);
-        output.emplace_back(title, value);
+        output.emplace_back(title, value, resource);
     }
     return output;
 }
@@ -171,13 +378,14 @@ libjdx::jdx::NTuples::splitValues(const std::vector<StringLdr>& ldrs)
     std::map<std::string, std::vector<std::string>> output;
     for (const auto& ldr : ldrs)
     {
-        auto valueString = util::stripLineComment(ldr.getValue(), true).first;
+        auto valueString
+            = util::stripLineComment(ldr.getValueView(), true).first;
         auto values = util::split(valueString, ",", true);
-        auto inserted = output.emplace(ldr.getLabel(), values).second;
+        auto inserted = output.emplace(ldr.getLabelView(), values).second;
         if (!inserted)
         {
-            throw ParseException(
-                "Duplicate LDR found in NTUPLE: " + ldr.getLabel());
+            throw ParseException("Duplicate LDR found in NTUPLE: "
+                                 + std::string{ldr.getLabelView()});
         }
     }
     return output;
@@ -259,8 +467,6 @@ libjdx::jdx::NTuplesAttributes libjdx::jdx::NTuples::map(
     auto maxString = findColumnValue("MAX");
     auto factorString = findColumnValue("FACTOR");
 
-    // TODO: make stol/stod more reliable (new util function) and use across
-    // project
     if (!varNameString)
     {
         throw ParseException("VAR_NAME missing in NTUPLES column: "
@@ -276,25 +482,28 @@ libjdx::jdx::NTuplesAttributes libjdx::jdx::NTuples::map(
     auto& varType = varTypeString;
     auto& varForm = varFormString;
 
-    auto varDim = varDimString && !varDimString.value().empty()
-                      ? std::optional<uint64_t>(std::stol(varDimString.value()))
-                      : std::nullopt;
+    auto varDim
+        = varDimString && !varDimString.value().empty()
+              ? std::optional<uint64_t>(util::toUInt64(varDimString.value()))
+              : std::nullopt;
     auto& units = unitsString;
-    auto first = firstString && !firstString.value().empty()
-                     ? std::optional<double>(std::stod(firstString.value()))
-                     : std::nullopt;
+    auto first
+        = firstString && !firstString.value().empty()
+              ? std::optional<double>(util::toDouble(firstString.value()))
+              : std::nullopt;
     auto last = lastString && !lastString.value().empty()
-                    ? std::optional<double>(std::stod(lastString.value()))
+                    ? std::optional<double>(util::toDouble(lastString.value()))
                     : std::nullopt;
     auto min = minString && !minString.value().empty()
-                   ? std::optional<double>(std::stod(minString.value()))
+                   ? std::optional<double>(util::toDouble(minString.value()))
                    : std::nullopt;
     auto max = maxString && !maxString.value().empty()
-                   ? std::optional<double>(std::stod(maxString.value()))
+                   ? std::optional<double>(util::toDouble(maxString.value()))
                    : std::nullopt;
-    auto factor = factorString && !factorString.value().empty()
-                      ? std::optional<double>(std::stod(factorString.value()))
-                      : std::nullopt;
+    auto factor
+        = factorString && !factorString.value().empty()
+              ? std::optional<double>(util::toDouble(factorString.value()))
+              : std::nullopt;
 
     std::vector<StringLdr> additionalAttrsInColum;
     for (const auto& var : additionalAttributes)
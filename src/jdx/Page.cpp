@@ -25,11 +25,12 @@
 libjdx::jdx::Page::Page(std::string& label, std::string pageVar,
     const std::vector<NTuplesAttributes>& nTuplesAttributes,
     const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-    std::optional<std::string>& nextLine)
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource,
+    bool skipData)
     : m_pageVariables{std::move(pageVar)}
 {
     validateInput(label);
-    parse(nTuplesAttributes, blockLdrs, reader, nextLine);
+    parse(nTuplesAttributes, blockLdrs, reader, nextLine, resource, skipData);
 }
 
 void libjdx::jdx::Page::validateInput(const std::string& label)
@@ -61,11 +62,12 @@ libjdx::jdx::Page::getDataTable() const
 void libjdx::jdx::Page::parse(
     const std::vector<NTuplesAttributes>& nTuplesAttributes,
     const std::vector<StringLdr>& blockLdrs, io::TextReader& reader,
-    std::optional<std::string>& nextLine)
+    std::optional<std::string>& nextLine, std::pmr::memory_resource* resource,
+    bool skipData)
 {
     // skip potential comment lines
     util::skipPureComments(reader, nextLine, false);
-    m_pageLdrs = parsePageLdrs(reader, nextLine);
+    m_pageLdrs = parsePageLdrs(reader, nextLine, resource);
     if (!nextLine.has_value() || !util::isLdrStart(nextLine.value()))
     {
         throw ParseException(
@@ -88,11 +90,18 @@ void libjdx::jdx::Page::parse(
 
     auto [dataTableVarList, plotDesc] = parseDataTableVars(value);
     m_dataTable.emplace(DataTable(label, dataTableVarList, plotDesc, blockLdrs,
-        nTuplesAttributes, m_pageLdrs, reader, nextLine));
+        nTuplesAttributes, m_pageLdrs, reader, nextLine, skipData));
+}
+
+void libjdx::jdx::Page::validateDataTableStart(const std::string& rawPageVars)
+{
+    auto [dataTableVarList, plotDesc] = parseDataTableVars(rawPageVars);
+    DataTable::validateStart(dataTableVarList, plotDesc);
 }
 
 std::vector<libjdx::jdx::StringLdr> libjdx::jdx::Page::parsePageLdrs(
-    io::TextReader& reader, std::optional<std::string>& nextLine)
+    io::TextReader& reader, std::optional<std::string>& nextLine,
+    std::pmr::memory_resource* resource)
 {
     std::vector<StringLdr> pageLdrs;
     while (nextLine.has_value())
@@ -106,11 +115,47 @@ std::vector<libjdx::jdx::StringLdr> libjdx::jdx::Page::parsePageLdrs(
         }
         // LDR is a regular LDR
         nextLine = parseStringValue(value, reader);
-        pageLdrs.emplace_back(label, value);
+        pageLdrs.emplace_back(label, value, resource);
     }
     return pageLdrs;
 }
 
+std::vector<std::string> libjdx::jdx::Page::splitDataTableVars(
+    const std::string& pageVars)
+{
+    // split at "," that follows ")" and optional whitespace, i.e., at
+    // R"((?<=\))\s*,\s*)", keep ")" but drop the whitespace
+    std::vector<std::string> segments;
+    size_t segmentStart = 0;
+    for (auto pos = pageVars.find(')'); pos != std::string::npos;
+         pos = pageVars.find(')', pos + 1))
+    {
+        auto commaPos = pos + 1;
+        while (commaPos < pageVars.size() && util::isSpace(pageVars[commaPos]))
+        {
+            ++commaPos;
+        }
+        if (commaPos >= pageVars.size() || pageVars[commaPos] != ',')
+        {
+            continue;
+        }
+        auto segment = pageVars.substr(segmentStart, pos + 1 - segmentStart);
+        util::trim(segment);
+        segments.push_back(std::move(segment));
+        segmentStart = commaPos + 1;
+        while (segmentStart < pageVars.size()
+               && util::isSpace(pageVars[segmentStart]))
+        {
+            ++segmentStart;
+        }
+        pos = segmentStart - 1;
+    }
+    auto segment = pageVars.substr(segmentStart);
+    util::trim(segment);
+    segments.push_back(std::move(segment));
+    return segments;
+}
+
 std::pair<std::string, std::optional<std::string>>
 libjdx::jdx::Page::parseDataTableVars(const std::string& rawPageVars)
 {
@@ -121,10 +166,7 @@ libjdx::jdx::Page::parseDataTableVars(const std::string& rawPageVars)
         throw ParseException(
             "Missing variable list in DATA TABLE: " + rawPageVars);
     }
-    // C++ does not support lookbehind syntax R"((?<=\))\s*,\s*)", so instead
-    // use non capturing group for ")" and split at capturing group
-    auto segments
-        = util::split(rawPageVarsTrimmed, R"((?:\))(\s*,\s*))", true, 1);
+    auto segments = splitDataTableVars(rawPageVarsTrimmed);
     if (segments.empty() || segments.size() > 2)
     {
         throw ParseException(
@@ -0,0 +1,30 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/ParallelDecoding.hpp"
+
+std::atomic<size_t> libjdx::jdx::ParallelDecoding::s_numThreads{1};
+
+void libjdx::jdx::ParallelDecoding::setNumThreads(size_t numThreads)
+{
+    s_numThreads = numThreads;
+}
+
+size_t libjdx::jdx::ParallelDecoding::getNumThreads()
+{
+    return s_numThreads;
+}
@@ -24,7 +24,7 @@ libjdx::jdx::PeakAssignments::PeakAssignments(const std::string& label,
     std::optional<std::string>& nextLine)
     : TabularData(label, std::move(variableList), reader)
 {
-    validateInput(getLabel(), getVariableList(), s_peakAssignentsLabel,
+    validateInput(getLabelView(), getVariableList(), s_peakAssignentsLabel,
         std::vector<std::string>{
             std::vector<std::string>{std::begin(s_peakAssignentsVariableLists),
                 std::end(s_peakAssignentsVariableLists)}});
@@ -34,7 +34,6 @@ libjdx::jdx::PeakAssignments::PeakAssignments(const std::string& label,
 std::vector<libjdx::jdx::PeakAssignment>
 libjdx::jdx::PeakAssignments::getData() const
 {
-    util::PeakAssignmentsParser parser{getReader(), getVariableList()};
     return TabularData::getData<util::PeakAssignmentsParser, PeakAssignment>(
-        parser);
+        getVariableList());
 }
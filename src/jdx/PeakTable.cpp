@@ -27,7 +27,7 @@ libjdx::jdx::PeakTable::PeakTable(const std::string& label,
     std::optional<std::string>& nextLine)
     : TabularData(label, std::move(variableList), reader)
 {
-    validateInput(getLabel(), getVariableList(), s_peakTableLabel,
+    validateInput(getLabelView(), getVariableList(), s_peakTableLabel,
         std::vector<std::string>{std::begin(s_peakTableVariableLists),
             std::end(s_peakTableVariableLists)});
     util::skipToNextLdr(reader, nextLine, true);
@@ -35,6 +35,6 @@ libjdx::jdx::PeakTable::PeakTable(const std::string& label,
 
 std::vector<libjdx::jdx::Peak> libjdx::jdx::PeakTable::getData() const
 {
-    util::PeakTableParser parser{getReader(), getVariableList()};
-    return TabularData::getData<util::PeakTableParser, Peak>(parser);
+    return TabularData::getData<util::PeakTableParser, Peak>(
+        getVariableList());
 }
@@ -41,10 +41,22 @@ const libjdx::jdx::RaParameters& libjdx::jdx::RaData::getParameters() const
 
 std::vector<std::pair<double, double>> libjdx::jdx::RaData::getData()
 {
-    return Data2D::parseXppYYData(getLabel(), getReader(), m_parameters.firstR,
+    return getSpectrum().toPairs();
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::RaData::getSpectrum() const
+{
+    return Data2D::parseXppYYData(getLabelView(), m_parameters.firstR,
         m_parameters.lastR, m_parameters.rFactor, m_parameters.nPoints);
 }
 
+size_t libjdx::jdx::RaData::decodeInto(double* x, double* y, size_t size) const
+{
+    return Data2D::decodeXppYYData(getLabelView(), m_parameters.firstR,
+        m_parameters.lastR, m_parameters.rFactor, m_parameters.nPoints, x, y,
+        size);
+}
+
 libjdx::jdx::RaParameters libjdx::jdx::RaData::parseParameters(
     const std::vector<StringLdr>& ldrs)
 {
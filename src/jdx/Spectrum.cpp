@@ -0,0 +1,149 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/Spectrum.hpp"
+
+#include <stdexcept>
+#include <string>
+
+libjdx::jdx::Spectrum::Spectrum()
+    : m_xValues{std::make_shared<const std::vector<double>>()}
+    , m_yValues{std::make_shared<const std::vector<double>>()}
+    , m_hasImplicitX{true}
+    , m_firstX{0.0}
+    , m_xIncrement{0.0}
+{
+}
+
+libjdx::jdx::Spectrum::Spectrum(
+    double firstX, double lastX, std::vector<double> yValues)
+    : m_xValues{std::make_shared<const std::vector<double>>()}
+    , m_yValues{std::make_shared<const std::vector<double>>(std::move(yValues))}
+    , m_hasImplicitX{true}
+    , m_firstX{firstX}
+    , m_xIncrement{computeXIncrement(firstX, lastX, m_yValues->size())}
+{
+}
+
+libjdx::jdx::Spectrum::Spectrum(
+    std::vector<double> xValues, std::vector<double> yValues)
+    : m_xValues{std::make_shared<const std::vector<double>>(std::move(xValues))}
+    , m_yValues{std::make_shared<const std::vector<double>>(std::move(yValues))}
+    , m_hasImplicitX{false}
+    , m_firstX{0.0}
+    , m_xIncrement{0.0}
+{
+    if (m_xValues->size() != m_yValues->size())
+    {
+        throw std::invalid_argument(
+            "Mismatch between number of x and y values. x: "
+            + std::to_string(m_xValues->size())
+            + ", y: " + std::to_string(m_yValues->size()));
+    }
+}
+
+double libjdx::jdx::Spectrum::computeXIncrement(
+    double firstX, double lastX, size_t nPoints)
+{
+    // cover special cases of zero and one points
+    const auto nominator = nPoints == 1 ? firstX : (lastX - firstX);
+    const auto denominator = nPoints <= 1 ? 1 : nPoints - 1;
+    return nominator / static_cast<double>(denominator);
+}
+
+size_t libjdx::jdx::Spectrum::size() const
+{
+    return m_yValues->size();
+}
+
+bool libjdx::jdx::Spectrum::empty() const
+{
+    return m_yValues->empty();
+}
+
+bool libjdx::jdx::Spectrum::hasImplicitX() const
+{
+    return m_hasImplicitX;
+}
+
+double libjdx::jdx::Spectrum::getFirstX() const
+{
+    return m_firstX;
+}
+
+double libjdx::jdx::Spectrum::getXIncrement() const
+{
+    return m_xIncrement;
+}
+
+double libjdx::jdx::Spectrum::getX(size_t index) const
+{
+    if (!m_hasImplicitX)
+    {
+        return m_xValues->at(index);
+    }
+    if (index >= m_yValues->size())
+    {
+        throw std::out_of_range(
+            "Spectrum index out of range: " + std::to_string(index));
+    }
+    return m_firstX + m_xIncrement * static_cast<double>(index);
+}
+
+double libjdx::jdx::Spectrum::getY(size_t index) const
+{
+    return m_yValues->at(index);
+}
+
+std::vector<double> libjdx::jdx::Spectrum::getXValues() const
+{
+    if (!m_hasImplicitX)
+    {
+        return *m_xValues;
+    }
+    std::vector<double> xValues;
+    xValues.reserve(m_yValues->size());
+    for (size_t i = 0; i < m_yValues->size(); ++i)
+    {
+        xValues.push_back(m_firstX + m_xIncrement * static_cast<double>(i));
+    }
+    return xValues;
+}
+
+const std::vector<double>& libjdx::jdx::Spectrum::getExplicitXValues() const
+{
+    return *m_xValues;
+}
+
+const std::vector<double>& libjdx::jdx::Spectrum::getYValues() const
+{
+    return *m_yValues;
+}
+
+std::vector<std::pair<double, double>> libjdx::jdx::Spectrum::toPairs() const
+{
+    std::vector<std::pair<double, double>> xyData{};
+    xyData.reserve(m_yValues->size());
+    for (size_t i = 0; i < m_yValues->size(); ++i)
+    {
+        const auto x = m_hasImplicitX
+                           ? m_firstX + m_xIncrement * static_cast<double>(i)
+                           : (*m_xValues)[i];
+        xyData.emplace_back(x, (*m_yValues)[i]);
+    }
+    return xyData;
+}
@@ -17,13 +17,19 @@
  */
 #include "jdx/StringLdr.hpp"
 
-libjdx::jdx::StringLdr::StringLdr(std::string label, std::string value)
-    : Ldr{std::move(label)}
-    , m_value{std::move(value)}
+libjdx::jdx::StringLdr::StringLdr(std::string_view label,
+    std::string_view value, std::pmr::memory_resource* resource)
+    : Ldr{label, resource}
+    , m_value{value, resource}
 {
 }
 
-const std::string& libjdx::jdx::StringLdr::getValue() const
+std::string libjdx::jdx::StringLdr::getValue() const
+{
+    return std::string{m_value};
+}
+
+std::string_view libjdx::jdx::StringLdr::getValueView() const
 {
     return m_value;
 }
@@ -38,27 +38,38 @@ std::optional<std::string> libjdx::jdx::TabularData::getWidthFunction()
               description.append(comment);
           };
 
-    auto getCommentLines = [this, &appendToDescription]() {
+    auto getCommentLines = [&appendToDescription](io::TextReader& reader) {
         // comment $$ in line(s) following LDR start may contain peak function
-        auto& reader = getReader();
-        auto readerPos = reader.tellg();
-        std::string line{};
         std::string functionDescription{};
-        while (!reader.eof() && !util::isLdrStart(line = reader.readLine())
-               && util::isPureComment(line))
+        while (!reader.eof())
         {
-            readerPos = reader.tellg();
+            auto line = reader.readLine();
+            if (util::isLdrStart(line) || !util::isPureComment(line))
+            {
+                // reset reader position to start of first assignment or start
+                // of next LDR
+                reader.unreadLine();
+                break;
+            }
             auto comment = util::stripLineComment(line).second;
             appendToDescription(comment.value(), functionDescription);
         }
-        // reset reader position to start of first assignment or start of next
-        // LDR
-        reader.seekg(readerPos);
         // return
         return functionDescription.empty()
                    ? std::nullopt
                    : std::optional<std::string>{functionDescription};
     };
 
-    return callAndResetStreamPos<std::optional<std::string>>(getCommentLines);
+    return readData<std::optional<std::string>>(getCommentLines);
+}
+
+bool libjdx::jdx::TabularData::isPureCommentLine(std::string_view line)
+{
+    auto pos = line.find_first_not_of(" \t\n\v\f\r");
+    if (pos == std::string_view::npos || line.substr(pos, 2) != "$$")
+    {
+        return false;
+    }
+    // "." does not match line terminators
+    return line.find_first_of("\r\n", pos + 2) == std::string_view::npos;
 }
@@ -29,8 +29,8 @@ libjdx::jdx::XyBase::XyBase(const std::string& label,
     io::TextReader& reader, std::optional<std::string>& nextLine)
     : Data2D{label, variableList, reader}
 {
-    validateInput(
-        getLabel(), getVariableList(), expectedLabel, expectedVariableLists);
+    validateInput(getLabelView(), getVariableList(), expectedLabel,
+        expectedVariableLists);
     m_parameters = parseParameters(ldrs);
     util::skipToNextLdr(reader, nextLine, true);
 }
@@ -40,18 +40,33 @@ const libjdx::jdx::XyParameters& libjdx::jdx::XyBase::getParameters() const
     return m_parameters;
 }
 
-std::vector<std::pair<double, double>> libjdx::jdx::XyBase::getXppYYData() const
+libjdx::jdx::Spectrum libjdx::jdx::XyBase::getXppYYData() const
 {
-    return Data2D::parseXppYYData(getLabel(), getReader(), m_parameters.firstX,
+    return Data2D::parseXppYYData(getLabelView(), m_parameters.firstX,
         m_parameters.lastX, m_parameters.yFactor, m_parameters.nPoints);
 }
 
-std::vector<std::pair<double, double>> libjdx::jdx::XyBase::getXYXYData() const
+libjdx::jdx::Spectrum libjdx::jdx::XyBase::getXYXYData() const
 {
-    return Data2D::parseXyXyData(getLabel(), getReader(), m_parameters.xFactor,
+    return Data2D::parseXyXyData(getLabelView(), m_parameters.xFactor,
         m_parameters.yFactor, m_parameters.nPoints);
 }
 
+size_t libjdx::jdx::XyBase::decodeXppYYInto(
+    double* x, double* y, size_t size) const
+{
+    return Data2D::decodeXppYYData(getLabelView(), m_parameters.firstX,
+        m_parameters.lastX, m_parameters.yFactor, m_parameters.nPoints, x, y,
+        size);
+}
+
+size_t libjdx::jdx::XyBase::decodeXYXYInto(
+    double* x, double* y, size_t size) const
+{
+    return Data2D::decodeXyXyData(getLabelView(), m_parameters.xFactor,
+        m_parameters.yFactor, m_parameters.nPoints, x, y, size);
+}
+
 libjdx::jdx::XyParameters libjdx::jdx::XyBase::parseParameters(
     const std::vector<StringLdr>& ldrs)
 {
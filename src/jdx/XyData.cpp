@@ -30,6 +30,11 @@ libjdx::jdx::XyData::XyData(const std::string& label,
 }
 
 std::vector<std::pair<double, double>> libjdx::jdx::XyData::getData()
+{
+    return getSpectrum().toPairs();
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::XyData::getSpectrum() const
 {
     auto varList = getVariableList();
     if (varList == s_ooQuirkVarList)
@@ -45,3 +50,20 @@ std::vector<std::pair<double, double>> libjdx::jdx::XyData::getData()
     }
     throw ParseException("Unsupported variable list for XYDATA: " + varList);
 }
+
+size_t libjdx::jdx::XyData::decodeInto(double* x, double* y, size_t size) const
+{
+    auto varList = getVariableList();
+    if (varList == s_ooQuirkVarList)
+    {
+        // Ocean Optics quirk
+        return XyBase::decodeXYXYInto(x, y, size);
+    }
+    if (std::any_of(s_xyDataVariableLists.begin(),
+            s_xyDataVariableLists.end() - 1,
+            [&varList](const std::string& s) { return s == varList; }))
+    {
+        return XyBase::decodeXppYYInto(x, y, size);
+    }
+    throw ParseException("Unsupported variable list for XYDATA: " + varList);
+}
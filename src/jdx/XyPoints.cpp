@@ -30,6 +30,11 @@ libjdx::jdx::XyPoints::XyPoints(const std::string& label,
 }
 
 std::vector<std::pair<double, double>> libjdx::jdx::XyPoints::getData() const
+{
+    return getSpectrum().toPairs();
+}
+
+libjdx::jdx::Spectrum libjdx::jdx::XyPoints::getSpectrum() const
 {
     auto varList = getVariableList();
     if (std::any_of(s_xyPointsVariableLists.begin(),
@@ -40,3 +45,16 @@ std::vector<std::pair<double, double>> libjdx::jdx::XyPoints::getData() const
     }
     throw ParseException("Unsupported variable list for XYPOINTS: " + varList);
 }
+
+size_t libjdx::jdx::XyPoints::decodeInto(
+    double* x, double* y, size_t size) const
+{
+    auto varList = getVariableList();
+    if (std::any_of(s_xyPointsVariableLists.begin(),
+            s_xyPointsVariableLists.end(),
+            [&varList](const std::string& s) { return s == varList; }))
+    {
+        return XyBase::decodeXYXYInto(x, y, size);
+    }
+    throw ParseException("Unsupported variable list for XYPOINTS: " + varList);
+}
@@ -31,8 +31,14 @@
 #endif
 
 libjdx::jdx::api::JdxConverter::JdxConverter(const std::string& path)
+    : JdxConverter(path, ParseOptions{})
+{
+}
+
+libjdx::jdx::api::JdxConverter::JdxConverter(
+    const std::string& path, const ParseOptions& options)
     : m_rootBlock{std::make_unique<libjdx::jdx::Block>(
-        libjdx::jdx::JdxParser::parse(path))}
+        libjdx::jdx::JdxParser::parse(path, options))}
 {
 }
 
@@ -74,7 +80,7 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::retrieveNode(
     auto raiseIllegalPathError = [](size_t nodeIndex, const Block* block) {
         throw std::invalid_argument(
             "Illegal path for reading node. Block: "
-            + block->getLdr("TITLE").value().getLabel()
+            + std::string{block->findLdr("TITLE")->getLabelView()}
             + ", child index: " + std::to_string(nodeIndex));
     };
 
@@ -155,12 +161,13 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::retrieveNode(
 libjdx::api::Node libjdx::jdx::api::JdxConverter::mapBlock(
     const Block& block, bool isPeakData)
 {
-    auto name = block.getLdr("TITLE").value().getValue();
+    auto name = std::string{block.findLdr("TITLE")->getValueView()};
 
     std::vector<libjdx::api::KeyValueParam> parameters{};
     for (auto const& ldr : block.getLdrs())
     {
-        parameters.push_back({ldr.getLabel(), ldr.getValue()});
+        parameters.push_back({std::string{ldr.getLabelView()},
+            std::string{ldr.getValueView()}});
     }
 
     auto data = mapData(block);
@@ -184,31 +191,29 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapBlock(
     std::vector<std::string> childNodeNames{};
     for (auto const& brukerRelaxSection : block.getBrukerRelaxSections())
     {
-        auto childNodeName = brukerRelaxSection.getName();
-        childNodeNames.push_back(childNodeName);
+        childNodeNames.emplace_back(brukerRelaxSection.getNameView());
     }
     for (auto const& brukerSpecificSection :
         block.getBrukerSpecificParameters())
     {
-        auto childNodeName = brukerSpecificSection.getName();
-        childNodeNames.push_back(childNodeName);
+        childNodeNames.emplace_back(brukerSpecificSection.getNameView());
     }
     if (block.getNTuples().has_value())
     {
         // consider NTUPLES LDR as child node
-        auto nTuplesName = block.getNTuples().value().getDataForm();
-        childNodeNames.push_back(nTuplesName);
+        childNodeNames.emplace_back(
+            block.getNTuples().value().getDataFormView());
     }
     if (block.getAuditTrail().has_value())
     {
         // consider AUDIT TRAIL LDR as child node
-        auto auditTrailLabel = block.getAuditTrail().value().getLabel();
-        childNodeNames.push_back(auditTrailLabel);
+        childNodeNames.emplace_back(
+            block.getAuditTrail().value().getLabelView());
     }
     for (auto const& childBlock : block.getBlocks())
     {
-        auto childNodeName = childBlock.getLdr("TITLE").value().getValue();
-        childNodeNames.push_back(childNodeName);
+        childNodeNames.emplace_back(
+            childBlock.findLdr("TITLE")->getValueView());
     }
 
     auto metadata = mapMetadata(block);
@@ -218,8 +223,10 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapBlock(
 
 bool libjdx::jdx::api::JdxConverter::isPeakData(const Block& block)
 {
-    auto dataType
-        = block.getLdr("DATATYPE").value_or(StringLdr{"", ""}).getValue();
+    const auto* dataTypeLdr = block.findLdr("DATATYPE");
+    auto dataType = dataTypeLdr == nullptr
+                        ? std::string{}
+                        : std::string{dataTypeLdr->getValueView()};
     util::toLower(dataType);
     return dataType == "mass spectrum";
 }
@@ -228,9 +235,9 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapBrukerRelaxSection(
     const BrukerRelaxSection& section)
 {
     std::vector<libjdx::api::KeyValueParam> parameters{};
-    parameters.push_back({"", section.getContent()});
+    parameters.push_back({"", std::string{section.getContentView()}});
     return {
-        section.getName(),
+        std::string{section.getNameView()},
         parameters,
         std::vector<libjdx::api::Point2D>{},
         std::map<std::string, std::string>{},
@@ -243,12 +250,13 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapBrukerSpecificParameters(
     const BrukerSpecificParameters& section)
 {
     std::vector<libjdx::api::KeyValueParam> parameters{};
-    for (const auto& ldr : section.getContent())
+    for (const auto& ldr : section.getLdrs())
     {
-        parameters.push_back({ldr.getLabel(), ldr.getValue()});
+        parameters.push_back({std::string{ldr.getLabelView()},
+            std::string{ldr.getValueView()}});
     }
     return {
-        section.getName(),
+        std::string{section.getNameView()},
         parameters,
         std::vector<libjdx::api::Point2D>{},
         std::map<std::string, std::string>{},
@@ -269,7 +277,8 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapNTuples(
         std::vector<libjdx::api::KeyValueParam> parameters{};
         for (const auto& ldr : nTuples.getLdrs())
         {
-            parameters.push_back({ldr.getLabel(), ldr.getValue()});
+            parameters.push_back({std::string{ldr.getLabelView()},
+                std::string{ldr.getValueView()}});
         }
 
         std::vector<libjdx::api::Point2D> data{};
@@ -312,7 +321,8 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapNTuplesPage(
     std::vector<libjdx::api::KeyValueParam> parameters{};
     for (auto&& ldr : page.getPageLdrs())
     {
-        parameters.push_back({ldr.getLabel(), ldr.getValue()});
+        parameters.push_back({std::string{ldr.getLabelView()},
+            std::string{ldr.getValueView()}});
     }
 
     std::vector<libjdx::api::Point2D> data{};
@@ -325,11 +335,12 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapNTuplesPage(
             parameters.push_back(
                 {"Plot Descriptor", dataTable.getPlotDescriptor().value()});
         }
-        data = mapXyData(dataTable.getData());
+        auto spectrum = dataTable.getSpectrum();
+        data = mapXyData(spectrum);
 
         if (isPeakData)
         {
-            peakTable = mapDataAsPeakTable(dataTable.getData());
+            peakTable = mapDataAsPeakTable(spectrum);
         }
     }
 
@@ -354,37 +365,46 @@ std::string libjdx::jdx::api::JdxConverter::mapNTuplesPageName(const Page& page)
 std::vector<libjdx::api::Point2D> libjdx::jdx::api::JdxConverter::mapData(
     const Block& block)
 {
-    std::optional<std::vector<std::pair<double, double>>> rawData{};
+    std::optional<Spectrum> spectrum{};
     if (block.getXyData())
     {
-        // TODO: fix const definitions that prevent rawData =
-        // block.getXyData().value().getData();
-        auto data = block.getXyData().value();
-        rawData = data.getData();
+        spectrum = block.getXyData().value().getSpectrum();
     }
     if (block.getRaData())
     {
-        auto data = block.getRaData().value();
-        rawData = data.getData();
+        spectrum = block.getRaData().value().getSpectrum();
     }
     if (block.getXyPoints())
     {
-        auto data = block.getXyPoints().value();
-        rawData = data.getData();
+        spectrum = block.getXyPoints().value().getSpectrum();
     }
 
-    return rawData ? mapXyData(rawData.value())
-                   : std::vector<libjdx::api::Point2D>{};
+    return spectrum ? mapXyData(spectrum.value())
+                    : std::vector<libjdx::api::Point2D>{};
 }
 
 std::vector<libjdx::api::Point2D> libjdx::jdx::api::JdxConverter::mapXyData(
-    const std::vector<std::pair<double, double>>& xyData)
+    const Spectrum& spectrum)
 {
-    std::vector<libjdx::api::Point2D> output{};
-    output.reserve(xyData.size());
-    for (const auto& pair : xyData)
+    const auto& yValues = spectrum.getYValues();
+    std::vector<libjdx::api::Point2D> output(yValues.size());
+    if (spectrum.hasImplicitX())
     {
-        output.push_back({pair.first, pair.second});
+        const auto firstX = spectrum.getFirstX();
+        const auto xIncrement = spectrum.getXIncrement();
+        for (size_t i = 0; i < yValues.size(); ++i)
+        {
+            output[i] = {firstX + xIncrement * static_cast<double>(i),
+                yValues[i]};
+        }
+    }
+    else
+    {
+        const auto& xValues = spectrum.getExplicitXValues();
+        for (size_t i = 0; i < yValues.size(); ++i)
+        {
+            output[i] = {xValues[i], yValues[i]};
+        }
     }
 
     return output;
@@ -395,13 +415,13 @@ std::map<std::string, std::string> libjdx::jdx::api::JdxConverter::mapMetadata(
 {
     std::map<std::string, std::string> metadata{};
 
-    if (auto xUnits = block.getLdr("XUNITS"))
+    if (const auto* xUnits = block.findLdr("XUNITS"))
     {
-        metadata.emplace("x.unit", xUnits.value().getValue());
+        metadata.emplace("x.unit", xUnits->getValueView());
     }
-    else if (auto rUnits = block.getLdr("RUNITS"))
+    else if (const auto* rUnits = block.findLdr("RUNITS"))
     {
-        metadata.emplace("x.unit", rUnits.value().getValue());
+        metadata.emplace("x.unit", rUnits->getValueView());
     }
 
     if (metadata.count("x.unit") > 0)
@@ -413,9 +433,9 @@ std::map<std::string, std::string> libjdx::jdx::api::JdxConverter::mapMetadata(
         {
             metadata.emplace("x.label", "Wavenumber");
 
-            if (block.getLdr("DATATYPE"))
+            if (const auto* dataTypeLdr = block.findLdr("DATATYPE"))
             {
-                auto dataType = block.getLdr("DATATYPE").value().getValue();
+                auto dataType = std::string{dataTypeLdr->getValueView()};
                 util::toLower(dataType);
 
                 if (dataType.find("infrared") != std::string::npos
@@ -432,13 +452,13 @@ std::map<std::string, std::string> libjdx::jdx::api::JdxConverter::mapMetadata(
         }
     }
 
-    if (auto yUnits = block.getLdr("YUNITS"))
+    if (const auto* yUnits = block.findLdr("YUNITS"))
     {
-        metadata.emplace("y.unit", yUnits.value().getValue());
+        metadata.emplace("y.unit", yUnits->getValueView());
     }
-    else if (auto aUnits = block.getLdr("AUNITS"))
+    else if (const auto* aUnits = block.findLdr("AUNITS"))
     {
-        metadata.emplace("y.unit", aUnits.value().getValue());
+        metadata.emplace("y.unit", aUnits->getValueView());
     }
 
     if (isPeakData(block))
@@ -537,18 +557,18 @@ libjdx::jdx::api::JdxConverter::mapPeakTableAsData(
 }
 
 libjdx::api::Table libjdx::jdx::api::JdxConverter::mapDataAsPeakTable(
-    const std::vector<std::pair<double, double>>& xyData)
+    const Spectrum& spectrum)
 {
     auto resultPeakTable = libjdx::api::Table{};
 
     resultPeakTable.columnNames.emplace_back("x", "Peak Position");
     resultPeakTable.columnNames.emplace_back("y", "Intensity");
 
-    for (const auto& xyPair : xyData)
+    for (size_t i = 0; i < spectrum.size(); ++i)
     {
         auto resultPeak = std::map<std::string, std::string>{};
-        resultPeak.emplace("x", std::to_string(xyPair.first));
-        resultPeak.emplace("y", std::to_string(xyPair.second));
+        resultPeak.emplace("x", std::to_string(spectrum.getX(i)));
+        resultPeak.emplace("y", std::to_string(spectrum.getY(i)));
         resultPeakTable.rows.push_back(resultPeak);
     }
 
@@ -660,7 +680,7 @@ libjdx::api::Node libjdx::jdx::api::JdxConverter::mapAuditTrail(
         table.rows.push_back(row);
     }
 
-    const auto& auditTrailLabel = auditTrail.getLabel();
+    const auto auditTrailLabel = std::string{auditTrail.getLabelView()};
 
     return {
         auditTrailLabel,
@@ -0,0 +1,36 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/Arena.hpp"
+
+void* libjdx::jdx::util::Arena::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_resource.allocate(bytes, alignment);
+}
+
+void libjdx::jdx::util::Arena::do_deallocate([[maybe_unused]] void* p,
+    [[maybe_unused]] size_t bytes, [[maybe_unused]] size_t alignment)
+{
+    // memory is released in bulk on destruction
+}
+
+bool libjdx::jdx::util::Arena::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
@@ -0,0 +1,58 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_ARENA_HPP
+#define JDX_ARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace libjdx::jdx::util
+{
+/**
+ * @brief A monotonic memory resource that may be used from multiple threads.
+ *
+ * Deallocation is a no-op, all memory is released in bulk when the arena is
+ * destroyed. Unlike std::pmr::monotonic_buffer_resource, allocations are
+ * synchronized, so that records parsed on demand from different threads may
+ * allocate from the same arena.
+ */
+class Arena : public std::pmr::memory_resource
+{
+public:
+    Arena() = default;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+    ~Arena() override = default;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    std::mutex m_mutex;
+    std::pmr::monotonic_buffer_resource m_resource;
+};
+} // namespace libjdx::jdx::util
+
+#endif // JDX_ARENA_HPP
@@ -23,7 +23,6 @@
 
 #include <algorithm>
 #include <map>
-#include <regex>
 
 libjdx::jdx::util::AuditTrailParser::AuditTrailParser(
     io::TextReader& reader, std::string variableList)
@@ -39,13 +38,69 @@ libjdx::jdx::util::AuditTrailParser::next()
             const std::string& tuple) { return createAuditTrailEntry(tuple); });
 }
 
+bool libjdx::jdx::util::AuditTrailParser::tokenize(
+    std::string_view tuple, std::vector<std::optional<std::string>>& tokens)
+{
+    auto pos = skipSpaces(tuple, 0);
+    if (pos >= tuple.size() || tuple[pos] != '(')
+    {
+        return false;
+    }
+    pos = skipSpaces(tuple, pos + 1);
+    // a single digit NUMBER
+    if (pos >= tuple.size() || tuple[pos] < '0' || tuple[pos] > '9')
+    {
+        return false;
+    }
+    tokens.at(1) = std::string{tuple.substr(pos, 1)};
+    ++pos;
+    // "<...>" segments
+    constexpr size_t maxSegments = 6;
+    std::array<std::string_view, maxSegments> segments{};
+    size_t numSegments = 0;
+    while (true)
+    {
+        pos = skipSpaces(tuple, pos);
+        if (pos >= tuple.size() || tuple[pos] != ',')
+        {
+            break;
+        }
+        pos = skipSpaces(tuple, pos + 1);
+        if (numSegments == maxSegments || pos >= tuple.size()
+            || tuple[pos] != '<')
+        {
+            return false;
+        }
+        const auto segmentEnd = tuple.find('>', pos + 1);
+        if (segmentEnd == std::string_view::npos)
+        {
+            return false;
+        }
+        segments.at(numSegments++)
+            = tuple.substr(pos + 1, segmentEnd - pos - 1);
+        pos = segmentEnd + 1;
+    }
+    if (pos >= tuple.size() || tuple[pos] != ')'
+        || skipSpaces(tuple, pos + 1) != tuple.size() || numSegments < 4)
+    {
+        return false;
+    }
+    // WHEN, WHO, WHERE, optional PROCESS and VERSION, WHAT
+    for (size_t i = 0; i < numSegments - 1; ++i)
+    {
+        tokens.at(i + 2) = std::string{segments.at(i)};
+    }
+    tokens.at(7) = std::string{segments.at(numSegments - 1)};
+    return true;
+}
+
 libjdx::jdx::AuditTrailEntry
 libjdx::jdx::util::AuditTrailParser::createAuditTrailEntry(
     const std::string& tuple) const
 {
     // tokenize
     // token[0] is the full match so extract 1 + 7 tokens for 7 groups
-    const auto tokens = extractTokens(tuple, m_regex, 1 + 7);
+    const auto tokens = extractTokens(tuple, tokenize, 1 + 7);
     const auto& varList = getVariableList();
 
     // error conditions {varList, {error condition, error message}}
@@ -24,6 +24,7 @@
 
 #include <array>
 #include <optional>
+#include <string_view>
 
 namespace libjdx::jdx::util
 {
@@ -54,20 +55,23 @@ private:
     };
 
     /**
-     * matches 5 - 7 audit trail entry segments as groups 1-7, groups 5 nd 6
+     * Extracts 5 - 7 audit trail entry segments as tokens 1-7, tokens 5 and 6
      * being optional, corresponding to one of (NUMBER, WHEN, WHO, WHERE, WHAT),
      * (NUMBER, WHEN, WHO, WHERE, VERSION, WHAT),
-     * (NUMBER, WHEN, WHO, WHERE, PROCESS, VERSION, WHAT)
+     * (NUMBER, WHEN, WHO, WHERE, PROCESS, VERSION, WHAT). Accepts the same
+     * input and yields the same tokens as the groups of regex:
+     * R"(^\s*\(\s*)"
+     * R"((\d))"
+     * R"((?:\s*,\s*<([^>]*)>))"
+     * R"((?:\s*,\s*<([^>]*)>))"
+     * R"((?:\s*,\s*<([^>]*)>))"
+     * R"((?:\s*,\s*<([^>]*)>)?)"
+     * R"((?:\s*,\s*<([^>]*)>)?)"
+     * R"((?:\s*,\s*<([^>]*)>))"
+     * R"(\s*\)\s*$)"
      */
-    const std::regex m_regex{R"(^\s*\(\s*)"
-                             R"((\d))"
-                             R"((?:\s*,\s*<([^>]*)>))"
-                             R"((?:\s*,\s*<([^>]*)>))"
-                             R"((?:\s*,\s*<([^>]*)>))"
-                             R"((?:\s*,\s*<([^>]*)>)?)"
-                             R"((?:\s*,\s*<([^>]*)>)?)"
-                             R"((?:\s*,\s*<([^>]*)>))"
-                             R"(\s*\)\s*$)"};
+    static bool tokenize(std::string_view tuple,
+        std::vector<std::optional<std::string>>& tokens);
 
     [[nodiscard]] libjdx::jdx::AuditTrailEntry createAuditTrailEntry(
         const std::string& tuple) const;
@@ -0,0 +1,307 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/CharClassifier.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__))                                \
+    && (defined(__GNUC__) || defined(__clang__)) && !defined(__EMSCRIPTEN__)
+#include <immintrin.h>
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define JDX_X86_SIMD 1
+#endif
+
+namespace
+{
+using libjdx::jdx::util::CharClassifier;
+using libjdx::jdx::util::CharClassMasks;
+
+enum CharClassBits : uint8_t
+{
+    Delimiter = 1U << 0U,
+    Digit = 1U << 1U,
+    Sqz = 1U << 2U,
+    Dif = 1U << 3U,
+    Dup = 1U << 4U,
+    Sign = 1U << 5U,
+    Exponent = 1U << 6U,
+    Missing = 1U << 7U,
+};
+
+constexpr std::array<uint8_t, 256> createCharClassTable()
+{
+    std::array<uint8_t, 256> table{};
+    // same as util::isSpace() for the "C" locale
+    for (const unsigned char c : {' ', '\t', '\n', '\v', '\f', '\r', ';', ','})
+    {
+        table[c] |= Delimiter;
+    }
+    for (unsigned char c = '0'; c <= '9'; ++c)
+    {
+        table[c] |= Digit;
+    }
+    for (unsigned char c = '@'; c <= 'I'; ++c)
+    {
+        table[c] |= Sqz;
+    }
+    for (unsigned char c = 'a'; c <= 'i'; ++c)
+    {
+        table[c] |= Sqz;
+    }
+    table['%'] |= Dif;
+    for (unsigned char c = 'J'; c <= 'R'; ++c)
+    {
+        table[c] |= Dif;
+    }
+    for (unsigned char c = 'j'; c <= 'r'; ++c)
+    {
+        table[c] |= Dif;
+    }
+    for (unsigned char c = 'S'; c <= 'Z'; ++c)
+    {
+        table[c] |= Dup;
+    }
+    table['s'] |= Dup;
+    table['+'] |= Sign;
+    table['-'] |= Sign;
+    table['E'] |= Exponent;
+    table['e'] |= Exponent;
+    table['?'] |= Missing;
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> s_charClassTable = createCharClassTable();
+
+CharClassMasks classifyScalar(const char* data, size_t size)
+{
+    CharClassMasks masks{};
+    for (size_t i = 0; i < size; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto c = static_cast<unsigned char>(data[i]);
+        const auto bits = s_charClassTable.at(c);
+        const auto bit = uint64_t{1} << i;
+        masks.delimiter |= (bits & Delimiter) != 0 ? bit : 0;
+        masks.digit |= (bits & Digit) != 0 ? bit : 0;
+        masks.sqz |= (bits & Sqz) != 0 ? bit : 0;
+        masks.dif |= (bits & Dif) != 0 ? bit : 0;
+        masks.dup |= (bits & Dup) != 0 ? bit : 0;
+        masks.sign |= (bits & Sign) != 0 ? bit : 0;
+        masks.exponent |= (bits & Exponent) != 0 ? bit : 0;
+        masks.missing |= (bits & Missing) != 0 ? bit : 0;
+    }
+    return masks;
+}
+
+#ifdef JDX_X86_SIMD
+// chunks at the end of the block are zero padded, zero is in no class
+template<size_t ChunkSize>
+std::array<char, ChunkSize> copyPaddedChunk(const char* data, size_t size)
+{
+    std::array<char, ChunkSize> buffer{};
+    std::memcpy(buffer.data(), data, std::min(size, ChunkSize));
+    return buffer;
+}
+
+__attribute__((target("sse4.2"))) uint64_t matchRangesSse42(
+    __m128i ranges, int numRangeChars, __m128i chunk, int chunkSize)
+{
+    // PCMPESTRM in ranges mode: pairs of inclusive bounds in "ranges"
+    constexpr int mode = _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_BIT_MASK;
+    const auto result
+        = _mm_cmpestrm(ranges, numRangeChars, chunk, chunkSize, mode);
+    return static_cast<uint64_t>(
+        static_cast<uint32_t>(_mm_cvtsi128_si32(result)) & 0xFFFFU);
+}
+
+__attribute__((target("sse4.2"))) CharClassMasks classifySse42(
+    const char* data, size_t size)
+{
+    const auto delimiterRanges = _mm_setr_epi8(
+        '\t', '\r', ' ', ' ', ';', ';', ',', ',', 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto digitRanges = _mm_setr_epi8(
+        '0', '9', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto sqzRanges = _mm_setr_epi8(
+        '@', 'I', 'a', 'i', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto difRanges = _mm_setr_epi8(
+        '%', '%', 'J', 'R', 'j', 'r', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto dupRanges = _mm_setr_epi8(
+        'S', 'Z', 's', 's', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto signRanges = _mm_setr_epi8(
+        '+', '+', '-', '-', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto exponentRanges = _mm_setr_epi8(
+        'E', 'E', 'e', 'e', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto missingRanges = _mm_setr_epi8(
+        '?', '?', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    CharClassMasks masks{};
+    constexpr size_t chunkSize = sizeof(__m128i);
+    for (size_t offset = 0; offset < size; offset += chunkSize)
+    {
+        const auto numChars = std::min(chunkSize, size - offset);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto buffer = copyPaddedChunk<chunkSize>(data + offset, numChars);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(buffer.data()));
+        const auto n = static_cast<int>(numChars);
+        masks.delimiter |= matchRangesSse42(delimiterRanges, 8, chunk, n)
+                           << offset;
+        masks.digit |= matchRangesSse42(digitRanges, 2, chunk, n) << offset;
+        masks.sqz |= matchRangesSse42(sqzRanges, 4, chunk, n) << offset;
+        masks.dif |= matchRangesSse42(difRanges, 6, chunk, n) << offset;
+        masks.dup |= matchRangesSse42(dupRanges, 4, chunk, n) << offset;
+        masks.sign |= matchRangesSse42(signRanges, 4, chunk, n) << offset;
+        masks.exponent |= matchRangesSse42(exponentRanges, 4, chunk, n)
+                          << offset;
+        masks.missing |= matchRangesSse42(missingRanges, 2, chunk, n)
+                         << offset;
+    }
+    return masks;
+}
+
+__attribute__((target("avx2"))) __m256i inRangeAvx2(
+    __m256i chunk, char lower, char upper)
+{
+    // signed comparison, non ASCII chars are negative and hence never inside
+    // the (ASCII) ranges
+    const auto belowLower = _mm256_set1_epi8(static_cast<char>(lower - 1));
+    const auto aboveUpper = _mm256_set1_epi8(static_cast<char>(upper + 1));
+    return _mm256_and_si256(_mm256_cmpgt_epi8(chunk, belowLower),
+        _mm256_cmpgt_epi8(aboveUpper, chunk));
+}
+
+__attribute__((target("avx2"))) __m256i equalsAvx2(__m256i chunk, char c)
+{
+    return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(c));
+}
+
+__attribute__((target("avx2"))) uint64_t toBitMaskAvx2(__m256i matches)
+{
+    return static_cast<uint64_t>(
+        static_cast<uint32_t>(_mm256_movemask_epi8(matches)));
+}
+
+__attribute__((target("avx2"))) CharClassMasks classifyAvx2(
+    const char* data, size_t size)
+{
+    CharClassMasks masks{};
+    constexpr size_t chunkSize = sizeof(__m256i);
+    for (size_t offset = 0; offset < size; offset += chunkSize)
+    {
+        const auto numChars = std::min(chunkSize, size - offset);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto buffer = copyPaddedChunk<chunkSize>(data + offset, numChars);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(buffer.data()));
+        const auto delimiter = _mm256_or_si256(
+            _mm256_or_si256(inRangeAvx2(chunk, '\t', '\r'),
+                equalsAvx2(chunk, ' ')),
+            _mm256_or_si256(equalsAvx2(chunk, ';'), equalsAvx2(chunk, ',')));
+        const auto sqz = _mm256_or_si256(
+            inRangeAvx2(chunk, '@', 'I'), inRangeAvx2(chunk, 'a', 'i'));
+        const auto dif = _mm256_or_si256(equalsAvx2(chunk, '%'),
+            _mm256_or_si256(
+                inRangeAvx2(chunk, 'J', 'R'), inRangeAvx2(chunk, 'j', 'r')));
+        const auto dup = _mm256_or_si256(
+            inRangeAvx2(chunk, 'S', 'Z'), equalsAvx2(chunk, 's'));
+        const auto sign
+            = _mm256_or_si256(equalsAvx2(chunk, '+'), equalsAvx2(chunk, '-'));
+        const auto exponent
+            = _mm256_or_si256(equalsAvx2(chunk, 'E'), equalsAvx2(chunk, 'e'));
+        masks.delimiter |= toBitMaskAvx2(delimiter) << offset;
+        masks.digit |= toBitMaskAvx2(inRangeAvx2(chunk, '0', '9')) << offset;
+        masks.sqz |= toBitMaskAvx2(sqz) << offset;
+        masks.dif |= toBitMaskAvx2(dif) << offset;
+        masks.dup |= toBitMaskAvx2(dup) << offset;
+        masks.sign |= toBitMaskAvx2(sign) << offset;
+        masks.exponent |= toBitMaskAvx2(exponent) << offset;
+        masks.missing |= toBitMaskAvx2(equalsAvx2(chunk, '?')) << offset;
+    }
+    return masks;
+}
+#endif
+
+CharClassifier::Kernel detectKernel()
+{
+#ifdef JDX_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return CharClassifier::Kernel::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return CharClassifier::Kernel::Sse42;
+    }
+#endif
+    return CharClassifier::Kernel::Scalar;
+}
+} // namespace
+
+libjdx::jdx::util::CharClassMasks libjdx::jdx::util::CharClassifier::classify(
+    std::string_view block)
+{
+    return classify(block, getKernel());
+}
+
+libjdx::jdx::util::CharClassMasks libjdx::jdx::util::CharClassifier::classify(
+    std::string_view block, Kernel kernel)
+{
+    const auto size = std::min(block.size(), s_blockSize);
+#ifdef JDX_X86_SIMD
+    if (kernel == Kernel::Avx2)
+    {
+        return classifyAvx2(block.data(), size);
+    }
+    if (kernel == Kernel::Sse42)
+    {
+        return classifySse42(block.data(), size);
+    }
+#else
+    static_cast<void>(kernel);
+#endif
+    return classifyScalar(block.data(), size);
+}
+
+libjdx::jdx::util::CharClassifier::Kernel
+libjdx::jdx::util::CharClassifier::getKernel()
+{
+    static const Kernel kernel = detectKernel();
+    return kernel;
+}
+
+libjdx::jdx::util::LineClassifier::LineClassifier(std::string_view line)
+    : m_line{line}
+    , m_blockStart{0}
+    , m_blockSize{0}
+    , m_blockValid{false}
+{
+}
+
+void libjdx::jdx::util::LineClassifier::classifyBlock(size_t blockStart)
+{
+    const auto block = m_line.substr(blockStart, CharClassifier::s_blockSize);
+    m_blockMasks = CharClassifier::classify(block);
+    m_blockStart = blockStart;
+    m_blockSize = block.size();
+    m_blockValid = true;
+}
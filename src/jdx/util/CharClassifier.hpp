@@ -0,0 +1,184 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_CHARCLASSIFIER_HPP
+#define JDX_CHARCLASSIFIER_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace libjdx::jdx::util
+{
+/**
+ * @brief Bit masks of character classes relevant for tokenizing (compressed)
+ * JCAMP-DX data. Bit i of each mask corresponds to the i-th char of a block.
+ */
+struct CharClassMasks
+{
+    /**
+     * @brief White space, ';' or ','.
+     */
+    uint64_t delimiter = 0;
+
+    /**
+     * @brief ASCII digits 0-9.
+     */
+    uint64_t digit = 0;
+
+    /**
+     * @brief SQZ digits @A-Ia-i.
+     */
+    uint64_t sqz = 0;
+
+    /**
+     * @brief DIF digits %J-Rj-r.
+     */
+    uint64_t dif = 0;
+
+    /**
+     * @brief DUP digits S-Zs.
+     */
+    uint64_t dup = 0;
+
+    /**
+     * @brief '+' or '-'.
+     */
+    uint64_t sign = 0;
+
+    /**
+     * @brief 'E' or 'e', i.e., exponent start or SQZ digit.
+     */
+    uint64_t exponent = 0;
+
+    /**
+     * @brief '?' for missing values.
+     */
+    uint64_t missing = 0;
+};
+
+/**
+ * @brief Classifies chars in blocks using SIMD instructions if available.
+ */
+class CharClassifier
+{
+public:
+    /**
+     * @brief The instruction set used for classification.
+     */
+    enum class Kernel
+    {
+        Scalar,
+        Sse42,
+        Avx2,
+    };
+
+    /**
+     * @brief Maximum number of chars classified at once.
+     */
+    static constexpr size_t s_blockSize = 64;
+
+    /**
+     * @brief Classifies a block of chars with the best kernel supported by the
+     * CPU.
+     * @param block The chars, only the first s_blockSize chars are classified.
+     * @return The masks. Bits beyond the block size are zero.
+     */
+    static CharClassMasks classify(std::string_view block);
+
+    /**
+     * @brief Classifies a block of chars with a specific kernel.
+     * @param block The chars, only the first s_blockSize chars are classified.
+     * @param kernel The kernel. Must be supported by the CPU.
+     * @return The masks. Bits beyond the block size are zero.
+     */
+    static CharClassMasks classify(std::string_view block, Kernel kernel);
+
+    /**
+     * @brief The best kernel supported by the CPU.
+     * @return The kernel used by classify(std::string_view).
+     */
+    static Kernel getKernel();
+
+    /**
+     * @brief Index of the least significant set bit.
+     * @param mask A non zero mask.
+     * @return The index.
+     */
+    static size_t findFirstSetBit(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(mask));
+#else
+        size_t index = 0;
+        while ((mask & 1U) == 0)
+        {
+            mask >>= 1U;
+            ++index;
+        }
+        return index;
+#endif
+    }
+};
+
+/**
+ * @brief Provides character class masks for arbitrary positions of a line.
+ * The line is classified lazily in blocks of CharClassifier::s_blockSize chars
+ * so that sequential access classifies every char once.
+ */
+class LineClassifier
+{
+public:
+    /**
+     * @brief Constructs from line.
+     * @param line The line. Must outlive this object.
+     */
+    explicit LineClassifier(std::string_view line);
+
+    /**
+     * @brief Character class masks of the block containing a position.
+     * @param pos A position in the line, must be smaller than the line length.
+     * @param blockStart Set to the position of the block's first char, i.e.,
+     * the position corresponding to bit 0 of the masks.
+     * @param blockSize Set to the number of chars in the block.
+     * @return The block's masks, valid until the next call.
+     */
+    const CharClassMasks& getMasks(
+        size_t pos, size_t& blockStart, size_t& blockSize)
+    {
+        // inline as this is called for every token
+        if (!m_blockValid || pos < m_blockStart
+            || pos >= m_blockStart + CharClassifier::s_blockSize)
+        {
+            classifyBlock(pos - pos % CharClassifier::s_blockSize);
+        }
+        blockStart = m_blockStart;
+        blockSize = m_blockSize;
+        return m_blockMasks;
+    }
+
+private:
+    std::string_view m_line;
+    size_t m_blockStart;
+    size_t m_blockSize;
+    bool m_blockValid;
+    CharClassMasks m_blockMasks;
+
+    void classifyBlock(size_t blockStart);
+};
+} // namespace libjdx::jdx::util
+
+#endif // JDX_CHARCLASSIFIER_HPP
@@ -18,86 +18,304 @@
 #include "util/DataParser.hpp"
 #include "jdx/ParseException.hpp"
 #include "util/LdrUtils.hpp"
+#include "util/NumberParser.hpp"
 #include "util/StringUtils.hpp"
+#include "util/ThreadPool.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <string>
 
 std::vector<double> libjdx::jdx::util::DataParser::readXppYYData(
-    io::TextReader& reader)
+    io::TextReader& reader, double yFactor, size_t numThreads)
+{
+    std::vector<double> yValues;
+    auto consume = [&yValues](double value) { yValues.push_back(value); };
+    forEachXppYYValue(reader, yFactor, numThreads, consume);
+    return yValues;
+}
+
+size_t libjdx::jdx::util::DataParser::readXppYYData(io::TextReader& reader,
+    double yFactor, double* yValues, size_t size, size_t numThreads)
+{
+    size_t count = 0;
+    auto consume = [yValues, size, &count](double value) {
+        if (count < size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            yValues[count] = value;
+        }
+        ++count;
+    };
+    forEachXppYYValue(reader, yFactor, numThreads, consume);
+    return count;
+}
+
+std::pair<std::vector<double>, std::vector<double>>
+libjdx::jdx::util::DataParser::readXyXyData(
+    io::TextReader& reader, double xFactor, double yFactor)
+{
+    std::vector<double> xValues;
+    std::vector<double> yValues;
+    auto consume = [&xValues, &yValues](bool isX, double value) {
+        (isX ? xValues : yValues).push_back(value);
+    };
+    forEachXyXyValue(reader, xFactor, yFactor, consume);
+    return {std::move(xValues), std::move(yValues)};
+}
+
+size_t libjdx::jdx::util::DataParser::readXyXyData(io::TextReader& reader,
+    double xFactor, double yFactor, double* xValues, double* yValues,
+    size_t size)
+{
+    size_t count = 0;
+    auto consume = [xValues, yValues, size, &count](bool isX, double value) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (isX)
+        {
+            if (count < size && xValues != nullptr)
+            {
+                xValues[count] = value;
+            }
+            return;
+        }
+        if (count < size)
+        {
+            yValues[count] = value;
+        }
+        ++count;
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    };
+    forEachXyXyValue(reader, xFactor, yFactor, consume);
+    return count;
+}
+
+template<typename Consumer>
+void libjdx::jdx::util::DataParser::forEachXppYYValue(io::TextReader& reader,
+    double yFactor, size_t numThreads, Consumer& consume)
 {
     static_assert(
         std::numeric_limits<double>::has_quiet_NaN, "No quiet NaN available.");
 
+    if (numThreads != 1)
+    {
+        forEachXppYYValueParallel(reader, yFactor, numThreads, consume);
+        return;
+    }
+
     // read (X++(Y..Y)) data
-    // TODO: possible performance tweak: yValues.reserve(NPOINTS)
-    std::vector<double> yValues;
-    std::string line;
-    std::streamoff pos = reader.tellg();
-    std::optional<double> yValueCheck = std::nullopt;
-    while (!util::isLdrStart(line = reader.readLine()))
+    XppYYState state;
+    std::string_view line;
+    while (!util::isLdrStart(line = reader.readLineView()))
     {
-        // save position to move back if next readLine() encounters LDR start
-        pos = reader.tellg();
         // pre-process line
-        auto data = util::stripLineComment(line, true).first;
-        // read Y values from line
-        auto [lineYValues, isDifEncoded] = readXppYYLine(data, yValueCheck);
-        if (yValueCheck.has_value())
+        auto data = util::stripLineCommentView(line, true).first;
+        processXppYYLine(data, yFactor, state, consume);
+    }
+    // next LDR encountered => all data read => move back to start of next LDR
+    reader.unreadLine();
+
+    if (state.hasPendingValue)
+    {
+        consume(state.pendingValue);
+    }
+}
+
+template<typename Consumer>
+void libjdx::jdx::util::DataParser::forEachXppYYValueParallel(
+    io::TextReader& reader, double yFactor, size_t numThreads,
+    Consumer& consume)
+{
+    // every line starts with an absolute (SQZ) value, so line aligned chunks
+    // can be decoded independently, the y check and the values replaced by
+    // it are reconciled at the chunk borders afterwards
+    // collect pre-processed lines, as the reader is not thread safe
+    std::string text;
+    std::vector<size_t> lineEnds;
+    std::exception_ptr readError;
+    try
+    {
+        std::string_view line;
+        while (!util::isLdrStart(line = reader.readLineView()))
         {
-            // y value is duplicated in new line, trust new value
-            yValues.pop_back();
+            text.append(util::stripLineCommentView(line, true).first);
+            lineEnds.push_back(text.size());
         }
-        // append line values to yValues
-        yValues.insert(
-            std::end(yValues), std::begin(lineYValues), std::end(lineYValues));
-        // if last and second to last values are defined, use last as y check
-        if (!isDifEncoded || lineYValues.empty()
-            || (lineYValues.size() == 1 && std::isnan(lineYValues.back()))
-            || (lineYValues.size() >= 2
-                && (std::isnan(lineYValues.back())
-                    || std::isnan(lineYValues[lineYValues.size() - 2]))))
+        reader.unreadLine();
+    }
+    catch (...)
+    {
+        // lines read so far may contain errors that take precedence
+        readError = std::current_exception();
+    }
+    auto getLine = [&text, &lineEnds](size_t index) {
+        const auto start = index == 0 ? 0 : lineEnds.at(index - 1);
+        return std::string_view{text}.substr(start, lineEnds.at(index) - start);
+    };
+
+    auto& pool = ThreadPool::getInstance();
+    const auto maxThreads = numThreads == 0 ? pool.getNumThreads() : numThreads;
+    const auto numLines = lineEnds.size();
+    const auto numChunks = std::max(
+        std::min(maxThreads, numLines / s_minLinesPerChunk), size_t{1});
+    struct Chunk
+    {
+        size_t firstLine = 0;
+        size_t endLine = 0;
+        std::vector<double> values;
+        // unscaled first value of the first line for the y check
+        std::optional<double> firstValue;
+        XppYYState state;
+        size_t errorLine = 0;
+        std::exception_ptr error;
+    };
+    std::vector<Chunk> chunks(numChunks);
+    for (size_t i = 0; i < numChunks; ++i)
+    {
+        chunks.at(i).firstLine = numLines * i / numChunks;
+        chunks.at(i).endLine = numLines * (i + 1) / numChunks;
+    }
+    pool.forEach(numChunks, maxThreads, [&](size_t index) {
+        auto& chunk = chunks.at(index);
+        auto consumeChunk
+            = [&chunk](double value) { chunk.values.push_back(value); };
+        for (auto i = chunk.firstLine; i < chunk.endLine; ++i)
         {
-            yValueCheck = std::nullopt;
+            try
+            {
+                processXppYYLine(
+                    getLine(i), yFactor, chunk.state, consumeChunk);
+            }
+            catch (...)
+            {
+                chunk.errorLine = i;
+                chunk.error = std::current_exception();
+                return;
+            }
+            if (i == chunk.firstLine && !chunk.state.lineYValues.empty())
+            {
+                chunk.firstValue = chunk.state.lineYValues.at(0).toDouble();
+            }
         }
-        else
+    });
+
+    // stitch chunks in order, errors are raised in the same order as when
+    // decoding sequentially
+    const Chunk* previous = nullptr;
+    for (const auto& chunk : chunks)
+    {
+        if (chunk.error && chunk.errorLine == chunk.firstLine)
+        {
+            std::rethrow_exception(chunk.error);
+        }
+        if (previous != nullptr)
+        {
+            const auto& yValueCheck = previous->state.yValueCheck;
+            if (yValueCheck.has_value() && chunk.firstValue.has_value()
+                && fabs(chunk.firstValue.value() - yValueCheck.value()) >= 1)
+            {
+                throw ParseException("Y value check failed in line: "
+                                     + std::string{getLine(chunk.firstLine)});
+            }
+            // if y value is duplicated in new line, trust new value
+            if (previous->state.hasPendingValue && !yValueCheck.has_value())
+            {
+                consume(previous->state.pendingValue);
+            }
+        }
+        for (const auto value : chunk.values)
+        {
+            consume(value);
+        }
+        if (chunk.error)
         {
-            yValueCheck = lineYValues.back();
+            std::rethrow_exception(chunk.error);
         }
+        previous = &chunk;
     }
-    // next LDR encountered => all data read => move back to start of next LDR
-    reader.seekg(pos);
+    if (readError)
+    {
+        std::rethrow_exception(readError);
+    }
+    if (previous != nullptr && previous->state.hasPendingValue)
+    {
+        consume(previous->state.pendingValue);
+    }
+}
 
-    return yValues;
+template<typename Consumer>
+void libjdx::jdx::util::DataParser::processXppYYLine(std::string_view data,
+    double yFactor, XppYYState& state, Consumer& consume)
+{
+    // values of a line are kept as integers as long as possible and only
+    // converted and scaled when consumed, this yields the same results as
+    // converting all values at once
+    auto& lineYValues = state.lineYValues;
+    // read Y values from line
+    lineYValues.clear();
+    auto isDifEncoded = readXppYYLine(data, state.yValueCheck, lineYValues);
+    if (state.hasPendingValue && !state.yValueCheck.has_value())
+    {
+        consume(state.pendingValue);
+    }
+    // if y value is duplicated in new line, trust new value
+    state.hasPendingValue = false;
+    const auto numLineValues = lineYValues.size();
+    for (size_t i = 0; i + 1 < numLineValues; ++i)
+    {
+        consume(lineYValues.at(i).toDouble() * yFactor);
+    }
+    if (numLineValues > 0)
+    {
+        state.hasPendingValue = true;
+        state.pendingValue = lineYValues.back().toDouble() * yFactor;
+    }
+    // if last and second to last values are defined, use last as y check
+    if (!isDifEncoded || numLineValues == 0
+        || std::isnan(lineYValues.back().toDouble())
+        || (numLineValues >= 2
+            && std::isnan(lineYValues.at(numLineValues - 2).toDouble())))
+    {
+        state.yValueCheck = std::nullopt;
+    }
+    else
+    {
+        state.yValueCheck = lineYValues.back().toDouble();
+    }
 }
 
-std::vector<std::pair<double, double>>
-libjdx::jdx::util::DataParser::readXyXyData(io::TextReader& reader)
+template<typename Consumer>
+void libjdx::jdx::util::DataParser::forEachXyXyValue(io::TextReader& reader,
+    double xFactor, double yFactor, Consumer& consume)
 {
     static_assert(
         std::numeric_limits<double>::has_quiet_NaN, "No quiet NaN available.");
 
     // read (XY..XY) data
-    std::vector<std::pair<double, double>> xyValues;
     bool lastValueIsXOnly = false;
-    std::string line;
-    std::streamoff pos = reader.tellg();
-    while (!util::isLdrStart(line = reader.readLine()))
+    double lastX = 0.0;
+    // reused for all lines to avoid allocations
+    DecodedValues lineValues;
+    std::string_view line;
+    while (!util::isLdrStart(line = reader.readLineView()))
     {
-        // save position to move back if next readLine() encounters LDR start
-        pos = reader.tellg();
         // pre-process line
-        auto data = util::stripLineComment(line, true).first;
+        auto data = util::stripLineCommentView(line, true).first;
         // read xy values from line
-        auto lineValues = readValues(data, false).first;
-        // turn line values into pairs and append line values to xyValues
-        for (auto value : lineValues)
+        lineValues.clear();
+        appendValues(data, false, lineValues);
+        // alternately consume line values as x and y values
+        for (size_t i = 0; i < lineValues.size(); ++i)
         {
+            const auto value = lineValues.at(i).toDouble();
             if (lastValueIsXOnly)
             {
                 // must be y value
-                xyValues.back().second = value;
+                consume(false, value * yFactor);
                 lastValueIsXOnly = false;
                 continue;
             }
@@ -105,45 +323,66 @@ libjdx::jdx::util::DataParser::readXyXyData(io::TextReader& reader)
             if (std::isnan(value))
             {
                 throw ParseException(
-                    "NaN value encountered as x value in line: " + line);
+                    "NaN value encountered as x value in line: "
+                    + std::string{line});
             }
-            std::pair<double, double> xyValue{
-                value, std::numeric_limits<double>::quiet_NaN()};
+            lastX = value * xFactor;
             lastValueIsXOnly = true;
-            xyValues.push_back(xyValue);
+            consume(true, lastX);
         }
     }
     // next LDR encountered => all data read => move back to start of next LDR
-    reader.seekg(pos);
+    reader.unreadLine();
 
     if (lastValueIsXOnly)
     {
         // uneven number of single values
         throw ParseException("Uneven number of values for xy data "
                              "encountered. No y value for x value: "
-                             + std::to_string(xyValues.back().first));
+                             + std::to_string(lastX));
     }
-    return xyValues;
 }
 
-// TODO: refactor to reduce complexity
 std::pair<std::vector<double>, bool>
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
 libjdx::jdx::util::DataParser::readValues(
-    std::string& encodedValues, bool isAsdf)
+    std::string_view encodedValues, bool isAsdf)
 {
-    // output
-    std::vector<double> yValues{};
+    DecodedValues values{};
+    auto difEncoded = appendValues(encodedValues, isAsdf, values);
+    return {values.toDoubles(), difEncoded};
+}
+
+// TODO: refactor to reduce complexity
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+bool libjdx::jdx::util::DataParser::appendValues(
+    std::string_view encodedValues, bool isAsdf, DecodedValues& values,
+    bool skipFirstValue)
+{
+    // output, values are appended to values
     bool difEncoded = false;
     // state
-    // for DIF/DUP previousTokenValue not same as last yValues value
-    std::optional<double> previousTokenValue{};
+    // for DIF/DUP previousTokenValue not same as last value
+    std::optional<DecodedValue> previousTokenValue{};
     TokenType previousTokenType = TokenType::Affn;
+    // last decoded value, also if skipped
+    DecodedValue lastValue{};
+    bool skipValue = skipFirstValue;
+    auto appendValue = [&values, &lastValue, &skipValue](
+                           const DecodedValue& value) {
+        lastValue = value;
+        if (skipValue)
+        {
+            skipValue = false;
+            return;
+        }
+        values.push(value);
+    };
     // loop
     size_t index = 0;
-    while (auto token = nextToken(encodedValues, index, isAsdf))
+    LineClassifier classifier{encodedValues};
+    while (auto token = nextToken(encodedValues, index, isAsdf, classifier))
     {
-        TokenType tokenType = toAffn(token.value());
+        TokenType tokenType = getTokenType(token.value().front());
         // it's not quite clear if DUP of DIF should also count as DIF encoded
         // Bruker seems to think so => apply same logic here
         difEncoded = tokenType == TokenType::Dif
@@ -159,101 +398,106 @@ libjdx::jdx::util::DataParser::readValues(
                     : std::string{"DIF"}
                           + " token without preceding token encountered in "
                             "sequence: "
-                          + encodedValues);
+                          + std::string{encodedValues});
         }
         if ((tokenType == TokenType::Dup && previousTokenValue.has_value()
                 && previousTokenType == TokenType::Dup))
         {
             throw ParseException(
                 "DUP token with preceding DUP token encountered in sequence: "
-                + encodedValues);
+                + std::string{encodedValues});
         }
 
         // process token
         if (tokenType == TokenType::Missing)
         {
             // ?
-            yValues.push_back(std::numeric_limits<double>::quiet_NaN());
-            previousTokenValue = std::numeric_limits<double>::quiet_NaN();
+            const auto nan = DecodedValue::fromDouble(
+                std::numeric_limits<double>::quiet_NaN());
+            appendValue(nan);
+            previousTokenValue = nan;
         }
         else if (tokenType == TokenType::Dup)
         {
-            auto numRepeats = std::stol(token.value());
+            auto numRepeats = parseDupCount(token.value());
             for (auto i{0}; i < numRepeats - 1; i++)
             {
                 if (previousTokenType == TokenType::Dif)
                 {
-                    auto lastValue = yValues.back();
-                    auto nextValue = lastValue + previousTokenValue.value();
-                    yValues.push_back(nextValue);
+                    // exact as long as values are integers
+                    appendValue(DecodedValue::add(
+                        lastValue, previousTokenValue.value()));
                 }
                 else
                 {
-                    yValues.push_back(yValues.back());
+                    appendValue(lastValue);
                 }
             }
-            previousTokenValue = numRepeats;
+            previousTokenValue = DecodedValue::fromInteger(numRepeats);
         }
         else
         {
-            // TODO: use std::from_chars from <charconv> header
-            // for better performance when more compilers support it
-            // see: https://en.cppreference.com/w/cpp/utility/from_chars
-            // https://gcc.gnu.org/onlinedocs/libstdc++/manual/status.html
-            auto value = std::stod(token.value());
+            auto value = parseTokenValue(token.value(), tokenType);
             if (tokenType == TokenType::Dif)
             {
                 if (previousTokenType == TokenType::Missing)
                 {
                     throw ParseException("DIF token with preceding ? token "
                                          "encountered in sequence: "
-                                         + encodedValues);
+                                         + std::string{encodedValues});
                 }
-                auto lastValue = yValues.back();
-                auto nextValue = lastValue + value;
-                yValues.push_back(nextValue);
+                // exact as long as values are integers
+                appendValue(DecodedValue::add(lastValue, value));
             }
             else
             {
-                yValues.push_back(value);
+                appendValue(value);
             }
             previousTokenValue = value;
         }
         previousTokenType = tokenType;
     }
-    return {yValues, difEncoded};
+    return difEncoded;
 }
 
-std::pair<std::vector<double>, bool>
-libjdx::jdx::util::DataParser::readXppYYLine(
-    std::string& line, const std::optional<double>& yValueCheck)
+bool libjdx::jdx::util::DataParser::readXppYYLine(std::string_view line,
+    const std::optional<double>& yValueCheck, DecodedValues& values)
 {
     // read (X++(Y..Y)) data line
-    auto [values, difEncoded] = readValues(line, true);
-    if (!values.empty())
-    {
-        // remove initial x value (not required for (X++(Y..Y)) encoded data)
-        values.erase(values.begin());
-        // skip X value check
-    }
+    // skip initial x value (not required for (X++(Y..Y)) encoded data), this
+    // also keeps y values as integers if x is not an integer
+    // skip X value check
+    auto difEncoded = appendValues(line, true, values, true);
     if (yValueCheck.has_value() && !values.empty())
     {
         // first y value is a duplicate, check if roughly the same
-        if (fabs(values.front() - yValueCheck.value()) >= 1)
+        if (fabs(values.at(0).toDouble() - yValueCheck.value()) >= 1)
         {
-            throw ParseException("Y value check failed in line: " + line);
+            throw ParseException(
+                "Y value check failed in line: " + std::string{line});
         }
     }
-    return {values, difEncoded};
+    return difEncoded;
 }
 
-std::optional<std::string> libjdx::jdx::util::DataParser::nextToken(
-    const std::string& line, size_t& pos, bool isAsdf)
+std::optional<std::string_view> libjdx::jdx::util::DataParser::nextToken(
+    std::string_view line, size_t& pos, bool isAsdf, LineClassifier& classifier)
 {
     // skip delimiters
-    while (pos < line.size() && isTokenDelimiter(line, pos))
-    {
-        pos++;
+    size_t blockStart = 0;
+    size_t blockSize = 0;
+    while (pos < line.size())
+    {
+        const auto& masks = classifier.getMasks(pos, blockStart, blockSize);
+        const auto shift = pos - blockStart;
+        const auto nonDelimiters = (~masks.delimiter >> shift)
+                                   & lowBitsMask(blockSize - shift);
+        if (nonDelimiters != 0)
+        {
+            pos += CharClassifier::findFirstSetBit(nonDelimiters);
+            break;
+        }
+        pos = blockStart + blockSize;
     }
     if (pos >= line.size())
     {
@@ -261,66 +505,178 @@ std::optional<std::string> libjdx::jdx::util::DataParser::nextToken(
     }
     if (!isTokenStart(line, pos, isAsdf))
     {
-        throw ParseException("illegal sequence encountered in line \"" + line
+        throw ParseException("illegal sequence encountered in line \""
+                             + std::string{line}
                              + "\" at position: " + std::to_string(pos));
     }
-    auto startIt = line.cbegin() + static_cast<long>(pos++);
-    while (!isTokenDelimiter(line, pos) && !isTokenStart(line, pos, isAsdf))
-    {
-        ++pos;
+    auto startPos = pos++;
+    // find token end, i.e., next delimiter or token start
+    while (pos < line.size())
+    {
+        const auto& masks = classifier.getMasks(pos, blockStart, blockSize);
+        const auto shift = pos - blockStart;
+        // digits and '.' only start a token after a delimiter, so inside a
+        // token these chars are no candidates for the token end
+        auto candidates = (masks.delimiter | masks.sqz | masks.dif | masks.dup
+                              | masks.sign | masks.missing)
+                          >> shift;
+        // exponent or sign of an exponent? => apply heuristic
+        const auto ambiguous = (masks.sign | masks.exponent) >> shift;
+        while (candidates != 0)
+        {
+            const auto offset = CharClassifier::findFirstSetBit(candidates);
+            if (((ambiguous >> offset) & 1U) == 0
+                || isTokenStart(line, pos + offset, isAsdf))
+            {
+                pos += offset;
+                return line.substr(startPos, pos - startPos);
+            }
+            // clear lowest set bit
+            candidates &= candidates - 1;
+        }
+        pos = blockStart + blockSize;
     }
-    auto endIt = line.cbegin() + static_cast<long>(pos);
-    return std::string{startIt, endIt};
+    return line.substr(startPos, pos - startPos);
 }
 
-libjdx::jdx::util::DataParser::TokenType libjdx::jdx::util::DataParser::toAffn(
-    std::string& token)
+uint64_t libjdx::jdx::util::DataParser::lowBitsMask(size_t numBits)
+{
+    return numBits >= 64 ? ~uint64_t{0} : (uint64_t{1} << numBits) - 1;
+}
+
+libjdx::jdx::util::DataParser::TokenType
+libjdx::jdx::util::DataParser::getTokenType(char c)
 {
-    auto c = token.front();
-    TokenType tokenType = TokenType::Affn;
-    std::optional<char> firstDigit;
     if (c == '?')
     {
-        tokenType = TokenType::Missing;
+        return TokenType::Missing;
     }
-    else if (isSqzDigit(c))
+    if (isSqzDigit(c))
     {
-        firstDigit = getSqzDigitValue(c);
-        tokenType = TokenType::Sqz;
+        return TokenType::Sqz;
     }
-    else if (isDifDigit(c))
+    if (isDifDigit(c))
     {
-        firstDigit = getDifDigitValue(c);
-        tokenType = TokenType::Dif;
+        return TokenType::Dif;
     }
-    else if (isDupDigit(c))
+    if (isDupDigit(c))
     {
-        firstDigit = getDupDigitValue(c);
-        tokenType = TokenType::Dup;
+        return TokenType::Dup;
     }
+    // must be plain AFFN or PAC (or illegal)
+    return TokenType::Affn;
+}
 
-    if (TokenType::Affn != tokenType && TokenType::Missing != tokenType)
+libjdx::jdx::util::DecodedValue
+libjdx::jdx::util::DataParser::parseTokenValue(
+    std::string_view token, TokenType tokenType)
+{
+    // decode integer values, the most common case for compressed data,
+    // directly into an accumulator
+    bool isNegative = false;
+    uint64_t mantissa = 0;
+    size_t numDigits = 0;
+    size_t i = 0;
+    if (tokenType == TokenType::Sqz || tokenType == TokenType::Dif)
+    {
+        // SQZ/DIF char (first char) represents sign and first digit
+        const char firstDigit = tokenType == TokenType::Sqz
+                                    ? getSqzDigitValue(token.front()).value()
+                                    : getDifDigitValue(token.front()).value();
+        isNegative = firstDigit < 0;
+        mantissa = static_cast<uint64_t>(isNegative ? -firstDigit : firstDigit);
+        numDigits = 1;
+        i = 1;
+    }
+    else if (token.front() == '+' || token.front() == '-')
+    {
+        isNegative = token.front() == '-';
+        i = 1;
+    }
+    for (; i < token.size() && numDigits < s_maxUint64Digits
+           && isAsciiDigit(token[i]);
+         ++i, ++numDigits)
+    {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(token[i] - '0');
+    }
+    if (i < token.size() || numDigits == 0)
+    {
+        // decimal point, exponent, very long or illegal value
+        return DecodedValue::fromDouble(
+            parseNonIntegerTokenValue(token, tokenType));
+    }
+    if (mantissa > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
     {
-        // replace SQZ/DIF/DUP char (first char) with (signed) value
-        // the below code should be faster than the naive:
-        // token.erase(0, 1);
-        // token.insert(0, std::to_string(firstDigit.value()));
-        const char value = firstDigit.value();
-        const char digit = value >= 0 ? static_cast<char>('0' + value)
-                                      : static_cast<char>('0' - value);
-        token[0] = digit;
+        // conversion is correctly rounded
+        const auto value = static_cast<double>(mantissa);
+        return DecodedValue::fromDouble(isNegative ? -value : value);
+    }
+    const auto value = static_cast<int64_t>(mantissa);
+    return DecodedValue::fromInteger(isNegative ? -value : value);
+}
+
+double libjdx::jdx::util::DataParser::parseNonIntegerTokenValue(
+    std::string_view token, TokenType tokenType)
+{
+    auto affnToken = token;
+    // SQZ/DIF tokens are converted to AFFN representation, on the stack unless
+    // the token is extremely long
+    std::array<char, s_tokenBufferSize> stackBuffer{};
+    std::string heapBuffer{};
+    if (tokenType == TokenType::Sqz || tokenType == TokenType::Dif)
+    {
+        char* buffer = stackBuffer.data();
+        // space for sign
+        if (token.size() + 1 > stackBuffer.size())
+        {
+            heapBuffer.resize(token.size() + 1);
+            buffer = heapBuffer.data();
+        }
+        auto* bufferEnd = buffer;
+        // replace SQZ/DIF char (first char) with (signed) value
+        const char value = tokenType == TokenType::Sqz
+                               ? getSqzDigitValue(token.front()).value()
+                               : getDifDigitValue(token.front()).value();
         if (value < 0)
         {
-            // TODO: possibly return +/- as separate bool to avoid insert()
-            token.insert(0, "-");
+            *bufferEnd++ = '-';
         }
+        *bufferEnd++ = value >= 0 ? static_cast<char>('0' + value)
+                                  : static_cast<char>('0' - value);
+        bufferEnd = std::copy(token.cbegin() + 1, token.cend(), bufferEnd);
+        affnToken = std::string_view{
+            buffer, static_cast<size_t>(bufferEnd - buffer)};
     }
-    // must be plain AFFN or PAC (or illegal)
-    return tokenType;
+
+    // trailing chars are ignored as with std::stod()
+    double value{};
+    if (parseDouble(affnToken, value) == 0)
+    {
+        throw ParseException(
+            "Illegal numeric value encountered: " + std::string{token});
+    }
+    return value;
+}
+
+long libjdx::jdx::util::DataParser::parseDupCount(std::string_view token)
+{
+    // DUP char (first char) represents first digit, trailing non digits are
+    // ignored
+    long count = getDupDigitValue(token.front()).value();
+    for (size_t i = 1; i < token.size() && isAsciiDigit(token[i]); ++i)
+    {
+        if (count > (std::numeric_limits<long>::max() - 9) / 10)
+        {
+            throw ParseException(
+                "Illegal DUP count encountered: " + std::string{token});
+        }
+        count = count * 10 + (token[i] - '0');
+    }
+    return count;
 }
 
 bool libjdx::jdx::util::DataParser::isTokenDelimiter(
-    const std::string& encodedValues, size_t index)
+    std::string_view encodedValues, size_t index)
 {
     if (index >= encodedValues.size())
     {
@@ -331,7 +687,7 @@ bool libjdx::jdx::util::DataParser::isTokenDelimiter(
 }
 
 bool libjdx::jdx::util::DataParser::isTokenStart(
-    const std::string& encodedValues, size_t index, bool isAsdf)
+    std::string_view encodedValues, size_t index, bool isAsdf)
 {
     if (index >= encodedValues.size())
     {
@@ -372,7 +728,7 @@ bool libjdx::jdx::util::DataParser::isTokenStart(
 }
 
 bool libjdx::jdx::util::DataParser::isExponentStart(
-    const std::string& encodedValues, size_t index, bool isAsdf)
+    std::string_view encodedValues, size_t index, bool isAsdf)
 {
     // a faster check for start of exponent instead of these regexes:
     // ^[eE][+-]{0,1}\\d{1,3}[;,\\s]{1}.*
@@ -381,8 +737,8 @@ bool libjdx::jdx::util::DataParser::isExponentStart(
     if (index >= encodedValues.size())
     {
         throw ParseException(
-            "Illegal index provided for exponent check. Line: " + encodedValues
-            + ", index: " + std::to_string(index));
+            "Illegal index provided for exponent check. Line: "
+            + std::string{encodedValues} + ", index: " + std::to_string(index));
     }
     auto i = index;
     auto curChar = encodedValues[i++];
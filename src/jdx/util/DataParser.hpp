@@ -19,9 +19,12 @@
 #define JDX_DATAPARSER_HPP
 
 #include "io/TextReader.hpp"
+#include "util/CharClassifier.hpp"
+#include "util/DecodedValues.hpp"
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace libjdx::jdx::util
@@ -32,11 +35,21 @@ namespace libjdx::jdx::util
 class DataParser
 {
 public:
-    static std::vector<double> readXppYYData(io::TextReader& reader);
-    static std::vector<std::pair<double, double>> readXyXyData(
-        io::TextReader& reader);
+    // numThreads > 1 decodes line aligned chunks in parallel, 0 uses all
+    // available threads, the result is identical to sequential decoding
+    static std::vector<double> readXppYYData(io::TextReader& reader,
+        double yFactor = 1.0, size_t numThreads = 1);
+    // writes at most size values, returns the total number of values
+    static size_t readXppYYData(io::TextReader& reader, double yFactor,
+        double* yValues, size_t size, size_t numThreads = 1);
+    static std::pair<std::vector<double>, std::vector<double>> readXyXyData(
+        io::TextReader& reader, double xFactor = 1.0, double yFactor = 1.0);
+    // writes at most size points, xValues may be nullptr, returns the total
+    // number of points
+    static size_t readXyXyData(io::TextReader& reader, double xFactor,
+        double yFactor, double* xValues, double* yValues, size_t size);
     static std::pair<std::vector<double>, bool> readValues(
-        std::string& encodedValues, bool isAsdf);
+        std::string_view encodedValues, bool isAsdf);
 
 private:
     enum class TokenType
@@ -47,17 +60,55 @@ private:
         Dup,
         Missing,
     };
-    static std::pair<std::vector<double>, bool> readXppYYLine(
-        std::string& line, const std::optional<double>& yValueCheck);
-    static std::optional<std::string> nextToken(
-        const std::string& line, size_t& pos, bool isAsdf);
-    static TokenType toAffn(std::string& token);
-    static bool isTokenDelimiter(
-        const std::string& encodedValues, size_t index);
+    // state carried from one (X++(Y..Y)) line to the next
+    struct XppYYState
+    {
+        // reused for all lines to avoid allocations
+        DecodedValues lineYValues;
+        // the last value of a line is only consumed once it is clear that it
+        // is not replaced by the y check value of the next line
+        bool hasPendingValue = false;
+        double pendingValue = 0.0;
+        std::optional<double> yValueCheck;
+    };
+    // min number of lines decoded by one thread
+    static constexpr size_t s_minLinesPerChunk = 256;
+
+    template<typename Consumer>
+    static void forEachXppYYValue(io::TextReader& reader, double yFactor,
+        size_t numThreads, Consumer& consume);
+    template<typename Consumer>
+    static void forEachXppYYValueParallel(io::TextReader& reader,
+        double yFactor, size_t numThreads, Consumer& consume);
+    template<typename Consumer>
+    static void processXppYYLine(std::string_view data, double yFactor,
+        XppYYState& state, Consumer& consume);
+    template<typename Consumer>
+    static void forEachXyXyValue(io::TextReader& reader, double xFactor,
+        double yFactor, Consumer& consume);
+    static bool appendValues(std::string_view encodedValues, bool isAsdf,
+        DecodedValues& values, bool skipFirstValue = false);
+    static bool readXppYYLine(std::string_view line,
+        const std::optional<double>& yValueCheck, DecodedValues& values);
+    // max number of decimal digits that always fit into uint64_t
+    static constexpr size_t s_maxUint64Digits = 19;
+    // size of the buffer for converting tokens to AFFN on the stack
+    static constexpr size_t s_tokenBufferSize = 64;
+
+    static std::optional<std::string_view> nextToken(std::string_view line,
+        size_t& pos, bool isAsdf, LineClassifier& classifier);
+    static uint64_t lowBitsMask(size_t numBits);
+    static TokenType getTokenType(char c);
+    static DecodedValue parseTokenValue(
+        std::string_view token, TokenType tokenType);
+    static double parseNonIntegerTokenValue(
+        std::string_view token, TokenType tokenType);
+    static long parseDupCount(std::string_view token);
+    static bool isTokenDelimiter(std::string_view encodedValues, size_t index);
     static bool isTokenStart(
-        const std::string& encodedValues, size_t index, bool isAsdf);
+        std::string_view encodedValues, size_t index, bool isAsdf);
     static bool isExponentStart(
-        const std::string& encodedValues, size_t index, bool isAsdf);
+        std::string_view encodedValues, size_t index, bool isAsdf);
     static bool isAsciiDigit(char c);
     static bool isSqzDigit(char c);
     static bool isDifDigit(char c);
@@ -0,0 +1,136 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/DecodedValues.hpp"
+
+#include <limits>
+
+libjdx::jdx::util::DecodedValue libjdx::jdx::util::DecodedValue::fromInteger(
+    int64_t value)
+{
+    return DecodedValue{true, value, 0.0};
+}
+
+libjdx::jdx::util::DecodedValue libjdx::jdx::util::DecodedValue::fromDouble(
+    double value)
+{
+    return DecodedValue{false, 0, value};
+}
+
+libjdx::jdx::util::DecodedValue libjdx::jdx::util::DecodedValue::add(
+    const DecodedValue& lhs, const DecodedValue& rhs)
+{
+    if (lhs.isInteger && rhs.isInteger)
+    {
+        constexpr auto max = std::numeric_limits<int64_t>::max();
+        constexpr auto min = std::numeric_limits<int64_t>::min();
+        if ((rhs.integer > 0 && lhs.integer <= max - rhs.integer)
+            || (rhs.integer <= 0 && lhs.integer >= min - rhs.integer))
+        {
+            return fromInteger(lhs.integer + rhs.integer);
+        }
+    }
+    // non integer or overflow
+    return fromDouble(lhs.toDouble() + rhs.toDouble());
+}
+
+double libjdx::jdx::util::DecodedValue::toDouble() const
+{
+    return isInteger ? static_cast<double>(integer) : real;
+}
+
+void libjdx::jdx::util::DecodedValues::push(const DecodedValue& value)
+{
+    if (m_isInteger && value.isInteger)
+    {
+        m_integers.push_back(value.integer);
+        return;
+    }
+    if (m_isInteger)
+    {
+        convertToDoubles();
+    }
+    m_doubles.push_back(value.toDouble());
+}
+
+void libjdx::jdx::util::DecodedValues::clear()
+{
+    m_isInteger = true;
+    m_integers.clear();
+    m_doubles.clear();
+}
+
+size_t libjdx::jdx::util::DecodedValues::size() const
+{
+    return m_isInteger ? m_integers.size() : m_doubles.size();
+}
+
+bool libjdx::jdx::util::DecodedValues::empty() const
+{
+    return size() == 0;
+}
+
+bool libjdx::jdx::util::DecodedValues::isInteger() const
+{
+    return m_isInteger;
+}
+
+libjdx::jdx::util::DecodedValue libjdx::jdx::util::DecodedValues::at(
+    size_t index) const
+{
+    return m_isInteger ? DecodedValue::fromInteger(m_integers.at(index))
+                       : DecodedValue::fromDouble(m_doubles.at(index));
+}
+
+libjdx::jdx::util::DecodedValue libjdx::jdx::util::DecodedValues::back() const
+{
+    return at(size() - 1);
+}
+
+std::vector<double> libjdx::jdx::util::DecodedValues::toDoubles(
+    double factor) const
+{
+    std::vector<double> output(size());
+    // simple loops that compilers can vectorize
+    if (m_isInteger)
+    {
+        for (size_t i = 0; i < m_integers.size(); ++i)
+        {
+            output[i] = factor * static_cast<double>(m_integers[i]);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < m_doubles.size(); ++i)
+        {
+            output[i] = factor * m_doubles[i];
+        }
+    }
+    return output;
+}
+
+void libjdx::jdx::util::DecodedValues::convertToDoubles()
+{
+    m_doubles.clear();
+    m_doubles.reserve(m_integers.size());
+    for (auto value : m_integers)
+    {
+        m_doubles.push_back(static_cast<double>(value));
+    }
+    m_integers.clear();
+    m_isInteger = false;
+}
@@ -0,0 +1,146 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_DECODEDVALUES_HPP
+#define JDX_DECODEDVALUES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libjdx::jdx::util
+{
+/**
+ * @brief A numeric value decoded from JCAMP-DX data. Integers are kept exact.
+ */
+struct DecodedValue
+{
+    /**
+     * @brief Creates an integer value.
+     * @param value The value.
+     * @return The decoded value.
+     */
+    static DecodedValue fromInteger(int64_t value);
+
+    /**
+     * @brief Creates a floating point value.
+     * @param value The value.
+     * @return The decoded value.
+     */
+    static DecodedValue fromDouble(double value);
+
+    /**
+     * @brief Adds two values. The sum is an integer if both summands are
+     * integers and the sum does not overflow.
+     * @param lhs The first summand.
+     * @param rhs The second summand.
+     * @return The sum.
+     */
+    static DecodedValue add(const DecodedValue& lhs, const DecodedValue& rhs);
+
+    /**
+     * @brief The value as double.
+     * @return The value.
+     */
+    [[nodiscard]] double toDouble() const;
+
+    /**
+     * @brief Whether the value is an integer.
+     */
+    bool isInteger = true;
+
+    /**
+     * @brief The value if it is an integer.
+     */
+    int64_t integer = 0;
+
+    /**
+     * @brief The value if it is not an integer.
+     */
+    double real = 0.0;
+};
+
+/**
+ * @brief A sequence of decoded values.
+ *
+ * As long as all values are integers, they are stored as int64_t. Once a non
+ * integer value is added, all values are converted to double and subsequent
+ * values are stored as double. This keeps DIF/DUP accumulation of integer
+ * encoded data exact and defers conversion and scaling to a single pass.
+ */
+class DecodedValues
+{
+public:
+    /**
+     * @brief Appends a value.
+     * @param value The value.
+     */
+    void push(const DecodedValue& value);
+
+    /**
+     * @brief Removes all values, retaining allocated memory.
+     */
+    void clear();
+
+    /**
+     * @brief The number of values.
+     * @return The number of values.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Whether there are any values.
+     * @return True if there are no values, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Whether all values are integers.
+     * @return True if all values are stored as integers, false otherwise.
+     */
+    [[nodiscard]] bool isInteger() const;
+
+    /**
+     * @brief The value at a position.
+     * @param index The position.
+     * @return The value.
+     */
+    [[nodiscard]] DecodedValue at(size_t index) const;
+
+    /**
+     * @brief The last value.
+     * @return The last value.
+     */
+    [[nodiscard]] DecodedValue back() const;
+
+    /**
+     * @brief Converts all values to double in one pass.
+     * @param factor A factor by which all values are multiplied.
+     * @return The scaled values.
+     */
+    [[nodiscard]] std::vector<double> toDoubles(double factor = 1.0) const;
+
+private:
+    bool m_isInteger = true;
+    std::vector<int64_t> m_integers;
+    std::vector<double> m_doubles;
+
+    void convertToDoubles();
+};
+} // namespace libjdx::jdx::util
+
+#endif // JDX_DECODEDVALUES_HPP
@@ -20,16 +20,38 @@
 #include "util/StringUtils.hpp"
 
 #include <algorithm>
-#include <regex>
 #include <string>
 #include <utility>
 
-bool libjdx::jdx::util::isLdrStart(const std::string& line)
+bool libjdx::jdx::util::isLdrStart(std::string_view line)
 {
-    static const std::regex regex{"\\s*##.*=.*"};
-    // match_continuous => match at start only
-    return std::regex_search(
-        line, regex, std::regex_constants::match_continuous);
+    // equivalent to matching regex "\\s*##.*=.*" at start of line, but without
+    // allocations as this is called for every line read
+    auto it = line.cbegin();
+    while (it != line.cend() && isSpace(*it))
+    {
+        ++it;
+    }
+    for (auto i{0}; i < 2; ++i)
+    {
+        if (it == line.cend() || *it++ != '#')
+        {
+            return false;
+        }
+    }
+    // "." does not match line terminators
+    for (; it != line.cend(); ++it)
+    {
+        if (*it == '=')
+        {
+            return true;
+        }
+        if (*it == '\n' || *it == '\r')
+        {
+            return false;
+        }
+    }
+    return false;
 }
 
 std::string libjdx::jdx::util::normalizeLdrStart(const std::string& ldr)
@@ -123,19 +145,25 @@ std::pair<std::string, std::string> libjdx::jdx::util::parseLdrStart(
 
 std::pair<std::string, std::optional<std::string>>
 libjdx::jdx::util::stripLineComment(
-    const std::string& line, bool trimContent, bool trimComment)
+    std::string_view line, bool trimContent, bool trimComment)
+{
+    auto [content, comment]
+        = stripLineCommentView(line, trimContent, trimComment);
+    return std::make_pair(std::string{content},
+        comment.has_value() ? std::optional<std::string>{comment.value()}
+                            : std::nullopt);
+}
+
+std::pair<std::string_view, std::optional<std::string_view>>
+libjdx::jdx::util::stripLineCommentView(
+    std::string_view line, bool trimContent, bool trimComment)
 {
     const auto pos = line.find("$$");
-    if (pos == std::string::npos)
+    if (pos == std::string_view::npos)
     {
         // no comment
-        if (!trimContent)
-        {
-            return make_pair(line, std::nullopt);
-        }
-        auto trimmedLine{line};
-        util::trim(trimmedLine);
-        return make_pair(trimmedLine, std::nullopt);
+        return std::make_pair(
+            trimContent ? util::trimView(line) : line, std::nullopt);
     }
 
     // separate comment
@@ -143,62 +171,58 @@ libjdx::jdx::util::stripLineComment(
     auto comment = line.substr(pos + 2);
     if (trimContent)
     {
-        util::trim(content);
+        content = util::trimView(content);
     }
     if (trimComment)
     {
-        util::trim(comment);
+        comment = util::trimView(comment);
     }
     return std::make_pair(content, comment);
 }
 
-std::optional<const libjdx::jdx::StringLdr> libjdx::jdx::util::findLdr(
+const libjdx::jdx::StringLdr* libjdx::jdx::util::findLdr(
     const std::vector<StringLdr>& ldrs, const std::string& label)
 {
     std::string normalizedLabel = normalizeLdrLabel(label);
     auto it = std::find_if(
         ldrs.begin(), ldrs.end(), [&normalizedLabel](const StringLdr& ldr) {
-            return ldr.getLabel() == normalizedLabel;
+            return ldr.getLabelView() == normalizedLabel;
         });
 
     if (it != ldrs.cend())
     {
-        return *it;
+        return &*it;
     }
-    return std::nullopt;
+    return nullptr;
 }
 
 std::optional<std::string> libjdx::jdx::util::findLdrValue(
     const std::vector<StringLdr>& ldrs, const std::string& label)
 {
-    auto ldr = util::findLdr(ldrs, label);
-    return ldr.has_value() ? std::optional<std::string>(ldr.value().getValue())
-                           : std::optional<std::string>(std::nullopt);
+    const auto* ldr = util::findLdr(ldrs, label);
+    return ldr != nullptr ? std::optional<std::string>(ldr->getValueView())
+                          : std::optional<std::string>(std::nullopt);
 }
 
 void libjdx::jdx::util::skipToNextLdr(io::TextReader& reader,
     std::optional<std::string>& nextLine, bool forceSkipFirstLine)
 {
-    if (forceSkipFirstLine)
+    if (!forceSkipFirstLine
+        && (!nextLine.has_value() || util::isLdrStart(nextLine.value())))
     {
-        if (reader.eof())
-        {
-            nextLine = std::nullopt;
-        }
-        else
-        {
-            nextLine = reader.readLine();
-        }
+        return;
     }
-    while (nextLine.has_value() && !util::isLdrStart(nextLine.value()))
+    while (!reader.eof())
     {
-        if (reader.eof())
+        // only copy the line once the next LDR is found
+        auto line = reader.readLineView();
+        if (util::isLdrStart(line))
         {
-            nextLine = std::nullopt;
-            continue;
+            nextLine = line;
+            return;
         }
-        nextLine = reader.readLine();
     }
+    nextLine = std::nullopt;
 }
 
 void libjdx::jdx::util::skipPureComments(io::TextReader& reader,
@@ -225,19 +249,19 @@ void libjdx::jdx::util::skipPureComments(io::TextReader& reader,
     }
 }
 
-bool libjdx::jdx::util::isPureComment(const std::string& line)
+bool libjdx::jdx::util::isPureComment(std::string_view line)
 {
     // only $$ comment?
-    auto preCommentValue = util::stripLineComment(line, true).first;
+    auto preCommentValue = util::stripLineCommentView(line, true).first;
     return preCommentValue.empty();
 }
 
-bool libjdx::jdx::util::isBrukerSpecificSectionStart(const std::string& line)
+bool libjdx::jdx::util::isBrukerSpecificSectionStart(std::string_view line)
 {
     return line.rfind("$$ Bruker specific parameters", 0) == 0;
 }
 
-bool libjdx::jdx::util::isBrukerSpecificSectionEnd(const std::string& line)
+bool libjdx::jdx::util::isBrukerSpecificSectionEnd(std::string_view line)
 {
     return line.rfind("$$ End of Bruker specific parameters", 0) == 0;
 }
@@ -20,11 +20,13 @@
 
 #include "io/TextReader.hpp"
 #include "jdx/StringLdr.hpp"
+#include "util/NumberParser.hpp"
 #include "util/StringUtils.hpp"
 
-#include <limits>
+#include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -33,14 +35,17 @@
  */
 namespace libjdx::jdx::util
 {
-bool isLdrStart(const std::string& line);
+bool isLdrStart(std::string_view line);
 std::string normalizeLdrStart(const std::string& ldr);
 std::string normalizeLdrLabel(const std::string& label);
 std::pair<std::string, std::string> parseLdrStart(const std::string& ldrStart);
 std::pair<std::string, std::optional<std::string>> stripLineComment(
-    const std::string& line, bool trimContent = false,
+    std::string_view line, bool trimContent = false,
     bool trimComment = false);
-std::optional<const StringLdr> findLdr(
+std::pair<std::string_view, std::optional<std::string_view>>
+stripLineCommentView(std::string_view line, bool trimContent = false,
+    bool trimComment = false);
+const StringLdr* findLdr(
     const std::vector<StringLdr>& ldrs, const std::string& label);
 std::optional<std::string> findLdrValue(
     const std::vector<StringLdr>& ldrs, const std::string& label);
@@ -48,9 +53,9 @@ void skipToNextLdr(io::TextReader& reader, std::optional<std::string>& nextLine,
     bool forceSkipFirstLine);
 void skipPureComments(io::TextReader& reader,
     std::optional<std::string>& nextLine, bool mustPrecedeLdr);
-bool isPureComment(const std::string& line);
-bool isBrukerSpecificSectionStart(const std::string& line);
-bool isBrukerSpecificSectionEnd(const std::string& line);
+bool isPureComment(std::string_view line);
+bool isBrukerSpecificSectionStart(std::string_view line);
+bool isBrukerSpecificSectionEnd(std::string_view line);
 
 template<typename T> struct LdrValueParser
 {
@@ -71,20 +76,15 @@ template<> struct LdrValueParser<double>
     static std::optional<double> parse(const std::string& value)
     {
         return value.empty() ? std::nullopt
-                             : std::optional<double>{std::stod(value)};
+                             : std::optional<double>{toDouble(value)};
     };
 };
 template<> struct LdrValueParser<uint64_t>
 {
     static std::optional<uint64_t> parse(const std::string& value)
     {
-        // we parse uint64_t as unsigned long and assign it to uint64_t
-        static_assert(std::numeric_limits<unsigned long>::max()
-                          // NOLINTNEXTLINE(misc-redundant-expression)
-                          <= std::numeric_limits<uint64_t>::max(),
-            "unsigned long max larger than uint_64_t max");
         return value.empty() ? std::nullopt
-                             : std::optional<uint64_t>{std::stoul(value)};
+                             : std::optional<uint64_t>{toUInt64(value)};
     };
 };
 
@@ -102,6 +102,56 @@ std::optional<T> parseLdrValue(
         = stripLineComment(stringValueOptional.value(), true).first;
     return LdrValueParser<T>::parse(stringValue);
 }
+
+/**
+ * @brief Calls a function that reads from a reader and restores the reader
+ * position afterwards, also if the function throws.
+ * @param reader The reader.
+ * @param func The function to call.
+ * @return The return value of the function.
+ */
+template<typename R>
+R callAndResetStreamPos(io::TextReader& reader, const std::function<R()>& func)
+{
+    const auto atEnd = reader.eof();
+    const auto pos = atEnd ? std::streampos{} : reader.tellg();
+    auto resetPosition = [atEnd, pos, &reader] {
+        if (!atEnd)
+        {
+            reader.seekg(pos);
+        }
+        else
+        {
+            reader.seekg(0, std::ios_base::end);
+        }
+    };
+
+    try
+    {
+        if constexpr (std::is_void_v<R>)
+        {
+            func();
+            resetPosition();
+        }
+        else
+        {
+            R returnValue = func();
+            resetPosition();
+            return returnValue;
+        }
+    }
+    catch (...)
+    {
+        try
+        {
+            resetPosition();
+        }
+        catch (...)
+        {
+        }
+        throw;
+    }
+}
 } // namespace libjdx::jdx::utils
 
 #endif
@@ -36,7 +36,6 @@ std::optional<std::string> libjdx::jdx::util::MultilineTuplesParser::nextTuple()
     // find start
     while (!m_reader.eof())
     {
-        std::streampos pos = m_reader.tellg();
         auto line = m_reader.readLine();
         auto lineStart = util::stripLineComment(line, true).first;
         if (isTupleStart(lineStart))
@@ -47,7 +46,7 @@ std::optional<std::string> libjdx::jdx::util::MultilineTuplesParser::nextTuple()
         if (util::isLdrStart(lineStart))
         {
             // LDR ended, no tuple
-            m_reader.seekg(pos);
+            m_reader.unreadLine();
             return std::nullopt;
         }
         if (!lineStart.empty())
@@ -65,14 +64,13 @@ std::optional<std::string> libjdx::jdx::util::MultilineTuplesParser::nextTuple()
     // read to end of current tuple
     while (!m_reader.eof())
     {
-        std::streampos pos = m_reader.tellg();
         auto line = m_reader.readLine();
         auto lineStart = util::stripLineComment(line, true).first;
 
         if (util::isLdrStart(lineStart))
         {
             // LDR ended before end of last tuple
-            m_reader.seekg(pos);
+            m_reader.unreadLine();
             throw ParseException(
                 std::string{"No closing parenthesis found for "}
                     .append(ldrName)
@@ -88,7 +86,7 @@ std::optional<std::string> libjdx::jdx::util::MultilineTuplesParser::nextTuple()
         if (m_reader.eof() || util::isLdrStart(lineStart))
         {
             // LDR ended before end of last tuple
-            m_reader.seekg(pos);
+            m_reader.unreadLine();
             throw ParseException(
                 std::string{"No closing parenthesis found for "}
                     .append(ldrName)
@@ -22,7 +22,6 @@
 #include "util/TuplesParser.hpp"
 
 #include <optional>
-#include <regex>
 
 namespace libjdx::jdx::util
 {
@@ -0,0 +1,377 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/NumberParser.hpp"
+#include "jdx/ParseException.hpp"
+#include "util/PowersOfFive.hpp"
+#include "util/StringUtils.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+
+namespace
+{
+// largest integer n such that all integers in [0, n] are exact doubles
+constexpr uint64_t s_maxExactInteger = uint64_t{1} << 53U;
+// powers of ten that are exact doubles
+constexpr std::array<double, 23> s_exactPowersOfTen{1e0, 1e1, 1e2, 1e3, 1e4,
+    1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+    1e18, 1e19, 1e20, 1e21, 1e22};
+// the fast path requires double arithmetic without extended precision
+constexpr bool s_isFastPathExact = FLT_EVAL_METHOD == 0;
+// number of decimal digits that always fit into uint64_t
+constexpr size_t s_maxMantissaDigits = 19;
+// exponents are clamped, larger exponents are out of range anyway
+constexpr int64_t s_maxExponent = 100'000;
+constexpr unsigned s_mantissaBits = 52;
+constexpr int64_t s_exponentBias = 1023;
+constexpr int64_t s_infiniteExponent = 0x7FF;
+
+struct UInt128
+{
+    uint64_t low;
+    uint64_t high;
+};
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+UInt128 multiply(uint64_t lhs, uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+    const auto product = static_cast<uint128>(lhs) * rhs;
+    return {static_cast<uint64_t>(product),
+        static_cast<uint64_t>(product >> 64U)};
+#else
+    constexpr uint64_t lowMask = 0xFFFF'FFFF;
+    const uint64_t lowLow = (lhs & lowMask) * (rhs & lowMask);
+    const uint64_t lowHigh = (lhs & lowMask) * (rhs >> 32U);
+    const uint64_t highLow = (lhs >> 32U) * (rhs & lowMask);
+    const uint64_t highHigh = (lhs >> 32U) * (rhs >> 32U);
+    const uint64_t cross = (lowLow >> 32U) + (highLow & lowMask) + lowHigh;
+    return {(cross << 32U) | (lowLow & lowMask),
+        highHigh + (highLow >> 32U) + (cross >> 32U)};
+#endif
+}
+
+int countLeadingZeros(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    while ((value & (uint64_t{1} << 63U)) == 0)
+    {
+        value <<= 1U;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Computes the double closest to mantissa * 10^exponent.
+ * @param mantissa A non zero decimal mantissa.
+ * @param exponent The decimal exponent.
+ * @return The correctly rounded value or std::nullopt if the value cannot be
+ * determined by the fast algorithms or is not a normal double.
+ */
+std::optional<double> computeDouble(uint64_t mantissa, int64_t exponent)
+{
+    // Clinger's fast path: both mantissa and power of ten are exact doubles,
+    // so a single correctly rounded operation yields the result
+    if (s_isFastPathExact && mantissa <= s_maxExactInteger && exponent >= -22
+        && exponent <= 22)
+    {
+        const auto value = static_cast<double>(mantissa);
+        const auto& powerOfTen = s_exactPowersOfTen.at(
+            static_cast<size_t>(exponent < 0 ? -exponent : exponent));
+        return exponent < 0 ? value / powerOfTen : value * powerOfTen;
+    }
+
+    // Eisel-Lemire: multiply the normalized mantissa with a 128 bit
+    // approximation of 5^exponent and check whether the truncated product
+    // determines the rounded result, see: D. Lemire, "Number Parsing at a
+    // Gigabyte per Second", Software: Practice and Experience 51 (8), 2021
+    if (exponent < libjdx::jdx::util::s_smallestPowerOfFive
+        || exponent > libjdx::jdx::util::s_largestPowerOfFive)
+    {
+        return std::nullopt;
+    }
+    const auto leadingZeros = countLeadingZeros(mantissa);
+    const uint64_t normalized = mantissa << static_cast<unsigned>(leadingZeros);
+    const auto index = static_cast<size_t>(
+        2 * (exponent - libjdx::jdx::util::s_smallestPowerOfFive));
+    auto product
+        = multiply(normalized, libjdx::jdx::util::s_powersOfFive.at(index));
+    // 55 bits are required: 53 bits mantissa, one for the leading bit of the
+    // product, one for rounding
+    constexpr uint64_t precisionMask = 0x1FF;
+    if ((product.high & precisionMask) == precisionMask)
+    {
+        // the lower bits might carry over, take more bits of 5^exponent into
+        // account
+        const auto lowProduct = multiply(
+            normalized, libjdx::jdx::util::s_powersOfFive.at(index + 1));
+        product.low += lowProduct.high;
+        if (lowProduct.high > product.low)
+        {
+            ++product.high;
+        }
+        if (product.low == ~uint64_t{0} && (exponent < -27 || exponent > 55))
+        {
+            // still ambiguous
+            return std::nullopt;
+        }
+    }
+    const auto upperBit = static_cast<unsigned>(product.high >> 63U);
+    const auto shift = upperBit + 64U - s_mantissaBits - 3U;
+    uint64_t resultMantissa = product.high >> shift;
+    // floor(log2(10^exponent)) = floor(exponent * 217706 / 2^16) for the
+    // exponent range of the table, relies on arithmetic right shift
+    const int64_t log2PowerOfTen = (217706 * exponent) >> 16U;
+    int64_t resultExponent = log2PowerOfTen + 63 + upperBit - leadingZeros
+                             + s_exponentBias;
+    if (resultExponent <= 0)
+    {
+        // subnormal or zero
+        return std::nullopt;
+    }
+    // for exponents in [-4, 23] the product can be exact, if it lies exactly
+    // halfway between two doubles round to even instead of up
+    if (product.low <= 1 && exponent >= -4 && exponent <= 23
+        && (resultMantissa & 3U) == 1
+        && (resultMantissa << shift) == product.high)
+    {
+        resultMantissa &= ~uint64_t{1};
+    }
+    resultMantissa += resultMantissa & 1U;
+    resultMantissa >>= 1U;
+    if (resultMantissa >= (uint64_t{2} << s_mantissaBits))
+    {
+        // rounding overflowed into the next binade
+        resultMantissa = uint64_t{1} << s_mantissaBits;
+        ++resultExponent;
+    }
+    resultMantissa &= ~(uint64_t{1} << s_mantissaBits);
+    if (resultExponent >= s_infiniteExponent)
+    {
+        return std::nullopt;
+    }
+    const uint64_t bits
+        = resultMantissa
+          | (static_cast<uint64_t>(resultExponent) << s_mantissaBits);
+    double value{};
+    static_assert(sizeof(value) == sizeof(bits), "Unexpected double size.");
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Computes mantissa * 10^exponent with strtod(). Slow but correct for
+ * all inputs.
+ * @return The value or std::nullopt if the value is out of range.
+ */
+std::optional<double> computeDoubleFallback(bool isNegative,
+    std::string_view integerDigits, std::string_view fractionDigits,
+    int64_t exponent)
+{
+    // representation without decimal point, so that the locale does not matter
+    std::string buffer;
+    buffer.reserve(integerDigits.size() + fractionDigits.size() + 24);
+    if (isNegative)
+    {
+        buffer += '-';
+    }
+    buffer += integerDigits;
+    buffer += fractionDigits;
+    if (integerDigits.empty() && fractionDigits.empty())
+    {
+        buffer += '0';
+    }
+    buffer += 'e';
+    buffer += std::to_string(exponent);
+
+    char* parseEnd = nullptr;
+    errno = 0;
+    const auto value = std::strtod(buffer.c_str(), &parseEnd);
+    if (parseEnd == buffer.c_str() || errno == ERANGE)
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+} // namespace
+
+size_t libjdx::jdx::util::parseDouble(std::string_view input, double& value)
+{
+    size_t pos = 0;
+    bool isNegative = false;
+    if (pos < input.size() && (input[pos] == '+' || input[pos] == '-'))
+    {
+        isNegative = input[pos] == '-';
+        ++pos;
+    }
+
+    // mantissa
+    uint64_t mantissa = 0;
+    size_t numSignificantDigits = 0;
+    auto accumulate = [&mantissa, &numSignificantDigits](char c) {
+        if (numSignificantDigits == 0 && c == '0')
+        {
+            // leading zero
+            return;
+        }
+        if (++numSignificantDigits <= s_maxMantissaDigits)
+        {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+        }
+    };
+    const auto integerStart = pos;
+    while (pos < input.size() && isDigit(input[pos]))
+    {
+        accumulate(input[pos++]);
+    }
+    const auto integerDigits = input.substr(integerStart, pos - integerStart);
+    std::string_view fractionDigits{};
+    if (pos < input.size() && input[pos] == '.')
+    {
+        const auto fractionStart = ++pos;
+        while (pos < input.size() && isDigit(input[pos]))
+        {
+            accumulate(input[pos++]);
+        }
+        fractionDigits = input.substr(fractionStart, pos - fractionStart);
+    }
+    if (integerDigits.empty() && fractionDigits.empty())
+    {
+        return 0;
+    }
+
+    // exponent, only consumed if it contains digits
+    int64_t exponent = 0;
+    if (pos < input.size() && (input[pos] == 'E' || input[pos] == 'e'))
+    {
+        auto exponentPos = pos + 1;
+        bool isNegativeExponent = false;
+        if (exponentPos < input.size()
+            && (input[exponentPos] == '+' || input[exponentPos] == '-'))
+        {
+            isNegativeExponent = input[exponentPos] == '-';
+            ++exponentPos;
+        }
+        if (exponentPos < input.size() && isDigit(input[exponentPos]))
+        {
+            while (exponentPos < input.size() && isDigit(input[exponentPos]))
+            {
+                if (exponent < s_maxExponent)
+                {
+                    exponent = exponent * 10 + (input[exponentPos] - '0');
+                }
+                ++exponentPos;
+            }
+            exponent = isNegativeExponent ? -exponent : exponent;
+            pos = exponentPos;
+        }
+    }
+    exponent -= static_cast<int64_t>(fractionDigits.size());
+
+    if (numSignificantDigits == 0)
+    {
+        value = isNegative ? -0.0 : 0.0;
+        return pos;
+    }
+    std::optional<double> result
+        = numSignificantDigits <= s_maxMantissaDigits
+              ? computeDouble(mantissa, exponent)
+              : std::nullopt;
+    if (!result)
+    {
+        const auto fallbackResult = computeDoubleFallback(
+            isNegative, integerDigits, fractionDigits, exponent);
+        if (!fallbackResult)
+        {
+            return 0;
+        }
+        value = fallbackResult.value();
+        return pos;
+    }
+    value = isNegative ? -result.value() : result.value();
+    return pos;
+}
+
+size_t libjdx::jdx::util::parseUInt64(std::string_view input, uint64_t& value)
+{
+    size_t pos = 0;
+    if (pos < input.size() && input[pos] == '+')
+    {
+        ++pos;
+    }
+    const auto digitsStart = pos;
+    uint64_t result = 0;
+    constexpr auto max = std::numeric_limits<uint64_t>::max();
+    while (pos < input.size() && isDigit(input[pos]))
+    {
+        const auto digit = static_cast<uint64_t>(input[pos] - '0');
+        if (result > (max - digit) / 10)
+        {
+            // overflow
+            return 0;
+        }
+        result = result * 10 + digit;
+        ++pos;
+    }
+    if (pos == digitsStart)
+    {
+        return 0;
+    }
+    value = result;
+    return pos;
+}
+
+double libjdx::jdx::util::toDouble(std::string_view input)
+{
+    const auto trimmed = trimView(input);
+    double value{};
+    if (parseDouble(trimmed, value) == 0)
+    {
+        throw ParseException(
+            "Illegal numeric value encountered: " + std::string{input});
+    }
+    return value;
+}
+
+uint64_t libjdx::jdx::util::toUInt64(std::string_view input)
+{
+    const auto trimmed = trimView(input);
+    uint64_t value{};
+    if (parseUInt64(trimmed, value) == 0)
+    {
+        throw ParseException(
+            "Illegal integer value encountered: " + std::string{input});
+    }
+    return value;
+}
@@ -0,0 +1,80 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_NUMBERPARSER_HPP
+#define JDX_NUMBERPARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Locale independent parsing of numbers that does not throw.
+ */
+namespace libjdx::jdx::util
+{
+/**
+ * @brief Parses a floating point number in AFFN notation, i.e.,
+ * "[+|-]digits[.digits][(E|e)[+|-]digits]", from the start of the input.
+ *
+ * The result is correctly rounded. Leading white space is not skipped,
+ * trailing characters are not consumed.
+ *
+ * @param input The characters to parse.
+ * @param value Receives the parsed value if parsing succeeds, unchanged
+ * otherwise.
+ * @return The number of characters consumed. Zero if the input does not start
+ * with a number or if the number is outside the range of normal doubles.
+ */
+size_t parseDouble(std::string_view input, double& value);
+
+/**
+ * @brief Parses an unsigned integer, i.e., "[+]digits", from the start of the
+ * input.
+ *
+ * @param input The characters to parse.
+ * @param value Receives the parsed value if parsing succeeds, unchanged
+ * otherwise.
+ * @return The number of characters consumed. Zero if the input does not start
+ * with an unsigned integer or if the integer does not fit into uint64_t.
+ */
+size_t parseUInt64(std::string_view input, uint64_t& value);
+
+/**
+ * @brief Converts a string to a double. Leading white space is skipped,
+ * trailing characters are ignored.
+ *
+ * @param input The string to convert.
+ * @return The parsed value.
+ * @throws ParseException If the string does not start with a number or the
+ * number is out of range.
+ */
+double toDouble(std::string_view input);
+
+/**
+ * @brief Converts a string to an unsigned integer. Leading white space is
+ * skipped, trailing characters are ignored.
+ *
+ * @param input The string to convert.
+ * @return The parsed value.
+ * @throws ParseException If the string does not start with an unsigned integer
+ * or the integer is out of range.
+ */
+uint64_t toUInt64(std::string_view input);
+} // namespace libjdx::jdx::util
+
+#endif // JDX_NUMBERPARSER_HPP
@@ -22,7 +22,6 @@
 #include "util/StringUtils.hpp"
 
 #include <algorithm>
-#include <regex>
 
 libjdx::jdx::util::PeakAssignmentsParser::PeakAssignmentsParser(
     io::TextReader& reader, std::string variableList)
@@ -38,13 +37,98 @@ libjdx::jdx::util::PeakAssignmentsParser::next()
             const std::string& tuple) { return createPeakAssignment(tuple); });
 }
 
+bool libjdx::jdx::util::PeakAssignmentsParser::tokenize(
+    std::string_view tuple, std::vector<std::optional<std::string>>& tokens)
+{
+    auto pos = skipSpaces(tuple, 0);
+    if (pos >= tuple.size() || tuple[pos] != '(')
+    {
+        return false;
+    }
+    // starts and ends of up to 5 comma separated segments, X and up to three
+    // optional segments followed by the segment starting with A, which itself
+    // may contain commas
+    constexpr size_t maxSegments = 5;
+    std::array<size_t, maxSegments> segmentStarts{};
+    std::array<size_t, maxSegments> segmentEnds{};
+    size_t numSegments = 0;
+    pos = skipSpaces(tuple, pos + 1);
+    while (numSegments < maxSegments)
+    {
+        segmentStarts.at(numSegments) = pos;
+        segmentEnds.at(numSegments)
+            = std::min(tuple.find(',', pos), tuple.size());
+        pos = segmentEnds.at(numSegments);
+        ++numSegments;
+        if (pos == tuple.size())
+        {
+            break;
+        }
+        pos = skipSpaces(tuple, pos + 1);
+    }
+    // as many optional segments as possible
+    for (auto aIndex = numSegments - 1; aIndex > 0; --aIndex)
+    {
+        auto assignment = extractAssignment(tuple, segmentStarts.at(aIndex));
+        if (!assignment)
+        {
+            continue;
+        }
+        for (size_t i = 0; i < aIndex; ++i)
+        {
+            tokens.at(i + 1) = std::string{tuple.substr(
+                segmentStarts.at(i), segmentEnds.at(i) - segmentStarts.at(i))};
+        }
+        tokens.at(5) = std::string{assignment.value()};
+        return true;
+    }
+    return false;
+}
+
+std::optional<std::string_view>
+libjdx::jdx::util::PeakAssignmentsParser::extractAssignment(
+    std::string_view tuple, size_t pos)
+{
+    if (pos >= tuple.size() || tuple[pos] != '<')
+    {
+        return std::nullopt;
+    }
+    // the tuple must end with ">", optional whitespace, ")", optional
+    // whitespace
+    auto end = tuple.size();
+    while (end > pos && isSpace(tuple[end - 1]))
+    {
+        --end;
+    }
+    if (end == pos || tuple[end - 1] != ')')
+    {
+        return std::nullopt;
+    }
+    --end;
+    while (end > pos && isSpace(tuple[end - 1]))
+    {
+        --end;
+    }
+    if (end <= pos + 1 || tuple[end - 1] != '>')
+    {
+        return std::nullopt;
+    }
+    auto assignment = tuple.substr(pos + 1, end - 1 - (pos + 1));
+    if (assignment.find_first_of("\r\n") != std::string_view::npos)
+    {
+        // no line breaks in A
+        return std::nullopt;
+    }
+    return assignment;
+}
+
 libjdx::jdx::PeakAssignment
 libjdx::jdx::util::PeakAssignmentsParser::createPeakAssignment(
     const std::string& tuple) const
 {
     // tokenize
     // token[0] is the full match so extract 1 + 5 tokens for 5 groups
-    const auto tokens = extractTokens(tuple, m_regex, 1 + 5);
+    const auto tokens = extractTokens(tuple, tokenize, 1 + 5);
     const auto& varList = getVariableList();
 
     // error conditions {varList, {error condition, error message}}
@@ -23,6 +23,7 @@
 #include "util/MultilineTuplesParser.hpp"
 
 #include <array>
+#include <string_view>
 
 namespace libjdx::jdx::util
 {
@@ -55,17 +56,26 @@ private:
     };
 
     /**
-     * matches 2 - 5 peak assignments segments  as groups 1-5, corresponding to
+     * Extracts 2 - 5 peak assignments segments as tokens 1-5, corresponding to
      * one of (X[, Y][, W], A), (X[, Y][, M], A), (X[, Y][, M][, W], A), with X
-     * as matches[1] and A as matches[5]
+     * as tokens[1] and A as tokens[5]. Accepts the same input and yields the
+     * same tokens as the groups of regex:
+     * R"(^\s*\(\s*)"
+     * R"(([^,]*))"
+     * R"((?:\s*,\s*([^,]*))?)"
+     * R"((?:\s*,\s*([^,]*))?)"
+     * R"((?:\s*,\s*([^,]*))?)"
+     * R"(\s*,\s*<(.*)>\s*\))"
+     * R"(\s*$)"
      */
-    const std::regex m_regex{R"(^\s*\(\s*)"
-                             R"(([^,]*))"
-                             R"((?:\s*,\s*([^,]*))?)"
-                             R"((?:\s*,\s*([^,]*))?)"
-                             R"((?:\s*,\s*([^,]*))?)"
-                             R"(\s*,\s*<(.*)>\s*\))"
-                             R"(\s*$)"};
+    static bool tokenize(std::string_view tuple,
+        std::vector<std::optional<std::string>>& tokens);
+    /**
+     * Extracts the assignment A, i.e., "<A>" followed by ")", from the tuple
+     * remainder starting at pos.
+     */
+    static std::optional<std::string_view> extractAssignment(
+        std::string_view tuple, size_t pos);
 
     [[nodiscard]] libjdx::jdx::PeakAssignment createPeakAssignment(
         const std::string& tuple) const;
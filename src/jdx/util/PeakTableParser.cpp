@@ -22,7 +22,6 @@
 #include "util/StringUtils.hpp"
 
 #include <algorithm>
-#include <regex>
 
 libjdx::jdx::util::PeakTableParser::PeakTableParser(
     io::TextReader& reader, std::string variableList)
@@ -50,12 +49,11 @@ std::optional<std::string> libjdx::jdx::util::PeakTableParser::nextTuple()
             return std::nullopt;
         }
 
-        auto pos = m_reader.tellg();
         auto nextLine = m_reader.readLine();
         if (util::isLdrStart(nextLine))
         {
             // next LDR => end of PEAK TABLE
-            m_reader.seekg(pos);
+            m_reader.unreadLine();
             return std::nullopt;
         }
 
@@ -65,8 +63,7 @@ std::optional<std::string> libjdx::jdx::util::PeakTableParser::nextTuple()
             // skip pure comments
             continue;
         }
-        auto tuples
-            = util::split(value, R"([^,\s](\s*(?:\s|;)\s*)[^,\s])", true, 1);
+        auto tuples = splitTuples(value);
         if (tuples.empty())
         {
             throw ParseException(
@@ -85,12 +82,85 @@ std::optional<std::string> libjdx::jdx::util::PeakTableParser::nextTuple()
     return tuple;
 }
 
+std::vector<std::string> libjdx::jdx::util::PeakTableParser::splitTuples(
+    std::string_view line)
+{
+    std::vector<std::string> tuples;
+    size_t tupleStart = 0;
+    size_t pos = 0;
+    while (pos + 1 < line.size())
+    {
+        if (line[pos] == ',' || isSpace(line[pos]))
+        {
+            ++pos;
+            continue;
+        }
+        // delimiter candidate following a char other than whitespace and ","
+        const auto delimiterStart = pos + 1;
+        const auto spacesEnd = skipSpaces(line, delimiterStart);
+        auto delimiterEnd = std::string_view::npos;
+        if (spacesEnd < line.size() && line[spacesEnd] == ';')
+        {
+            const auto semicolonSpacesEnd = skipSpaces(line, spacesEnd + 1);
+            if (semicolonSpacesEnd < line.size()
+                && line[semicolonSpacesEnd] != ',')
+            {
+                delimiterEnd = semicolonSpacesEnd;
+            }
+            else if (spacesEnd > delimiterStart)
+            {
+                // ";" starts the next tuple
+                delimiterEnd = spacesEnd;
+            }
+        }
+        else if (spacesEnd > delimiterStart && spacesEnd < line.size()
+                 && line[spacesEnd] != ',')
+        {
+            delimiterEnd = spacesEnd;
+        }
+        if (delimiterEnd == std::string_view::npos)
+        {
+            ++pos;
+            continue;
+        }
+        tuples.emplace_back(
+            trimView(line.substr(tupleStart, delimiterStart - tupleStart)));
+        tupleStart = delimiterEnd;
+        pos = delimiterEnd;
+    }
+    tuples.emplace_back(trimView(line.substr(tupleStart)));
+    return tuples;
+}
+
+bool libjdx::jdx::util::PeakTableParser::tokenize(
+    std::string_view tuple, std::vector<std::optional<std::string>>& tokens)
+{
+    const auto numCommas = std::count(tuple.cbegin(), tuple.cend(), ',');
+    const auto numSegments = 1 + static_cast<size_t>(numCommas);
+    if (numSegments < 2 || numSegments > 3)
+    {
+        return false;
+    }
+    size_t pos = 0;
+    for (size_t i = 1; i <= numSegments; ++i)
+    {
+        // leading whitespace is skipped, trailing whitespace is retained
+        const auto segmentStart = skipSpaces(tuple, pos);
+        const auto segmentEnd
+            = std::min(tuple.find(',', segmentStart), tuple.size());
+        tokens.at(i) = std::string{
+            tuple.substr(segmentStart, segmentEnd - segmentStart)};
+        pos = segmentEnd + 1;
+    }
+    return true;
+}
+
 libjdx::jdx::Peak libjdx::jdx::util::PeakTableParser::createPeak(
     const std::string& tuple) const
 {
     // tokenize
     // token[0] is the full match so extract 1 + 3 tokens for 3 groups
-    const auto tokens = extractTokens(tuple, m_regex, 1 + 3);
+    const auto tokens = extractTokens(tuple, tokenize, 1 + 3);
     const auto& varList = getVariableList();
 
     // error conditions {varList, {error condition, error message}}
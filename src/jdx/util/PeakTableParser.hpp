@@ -25,7 +25,7 @@
 #include <array>
 #include <optional>
 #include <queue>
-#include <regex>
+#include <string_view>
 
 namespace libjdx::jdx::util
 {
@@ -55,22 +55,30 @@ private:
         "(XYM..XYM)",
     };
 
-    /**
-     * matches 2-3 peak segments as groups 1-3, corresponding to
-     * (XY..XY), (XYW..XYW), or (XYM..XYM), with X as matches[1], Y as matche[2]
-     * and W or M as matches[3]
-     */
-    const std::regex m_regex{R"(^\s*)"
-                             R"(([^,]*))"
-                             R"((?:\s*,\s*([^,]*)))"
-                             R"((?:\s*,\s*([^,]*))?)"
-                             R"($)"};
-
     io::TextReader& m_reader;
     std::queue<std::string> m_tuples;
 
     // tuple
     std::optional<std::string> nextTuple();
+    /**
+     * Splits a line into tuples at whitespace that contains at most one ";"
+     * and is enclosed by chars other than whitespace and ",", i.e., at group 1
+     * of regex "[^,\s](\s*(?:\s|;)\s*)[^,\s]". The tuples are trimmed.
+     */
+    static std::vector<std::string> splitTuples(std::string_view line);
+    /**
+     * Extracts 2-3 peak segments as tokens 1-3, corresponding to (XY..XY),
+     * (XYW..XYW), or (XYM..XYM), with X as tokens[1], Y as tokens[2] and W or
+     * M as tokens[3]. Accepts the same input and yields the same tokens as the
+     * groups of regex:
+     * R"(^\s*)"
+     * R"(([^,]*))"
+     * R"((?:\s*,\s*([^,]*)))"
+     * R"((?:\s*,\s*([^,]*))?)"
+     * R"($)"
+     */
+    static bool tokenize(std::string_view tuple,
+        std::vector<std::optional<std::string>>& tokens);
     // peak
     [[nodiscard]] libjdx::jdx::Peak createPeak(const std::string& tuple) const;
 };
@@ -20,7 +20,6 @@
 
 #include <algorithm>
 #include <functional>
-#include <regex>
 #include <string>
 
 void libjdx::jdx::util::trimLeft(std::string& s)
@@ -40,6 +39,19 @@ void libjdx::jdx::util::trim(std::string& s)
     trimLeft(s);
 }
 
+std::string_view libjdx::jdx::util::trimView(std::string_view s)
+{
+    while (!s.empty() && isSpace(s.back()))
+    {
+        s.remove_suffix(1);
+    }
+    while (!s.empty() && isSpace(s.front()))
+    {
+        s.remove_prefix(1);
+    }
+    return s;
+}
+
 bool libjdx::jdx::util::isSpace(char c)
 {
     return static_cast<bool>(std::isspace(static_cast<unsigned char>(c)));
@@ -51,23 +63,21 @@ void libjdx::jdx::util::toLower(std::string& s)
         [](unsigned char c) { return std::tolower(c); });
 }
 
-std::vector<std::string> libjdx::jdx::util::split(const std::string& input,
-    const std::string& delimiterRegEx, bool trimSegments, size_t matchGroup)
+std::vector<std::string> libjdx::jdx::util::split(std::string_view input,
+    const std::string& delimiter, bool trimSegments)
 {
-    auto remainder = input;
-    std::regex delimiter{delimiterRegEx};
-    std::smatch match;
     std::vector<std::string> output;
-    while (std::regex_search(remainder, match, delimiter))
+    size_t segmentStart = 0;
+    if (!delimiter.empty())
     {
-        auto matchPos = static_cast<size_t>(match.position(matchGroup));
-        std::string segment = remainder.substr(0, matchPos);
-        output.push_back(segment);
-        auto nextPos
-            = matchPos + static_cast<size_t>(match[matchGroup].length());
-        remainder = remainder.substr(nextPos);
+        for (auto pos = input.find(delimiter); pos != std::string_view::npos;
+             pos = input.find(delimiter, segmentStart))
+        {
+            output.emplace_back(input.substr(segmentStart, pos - segmentStart));
+            segmentStart = pos + delimiter.size();
+        }
     }
-    output.push_back(remainder);
+    output.emplace_back(input.substr(segmentStart));
 
     if (trimSegments)
     {
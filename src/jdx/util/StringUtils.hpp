@@ -19,6 +19,7 @@
 #define JDX_STRINGUTILS_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -27,13 +28,13 @@
 namespace libjdx::jdx::util
 {
 void trim(std::string& s);
+std::string_view trimView(std::string_view s);
 void trimLeft(std::string& s);
 void trimRight(std::string& s);
 bool isSpace(char c);
 void toLower(std::string& s);
-std::vector<std::string> split(const std::string& input,
-    const std::string& delimiterRegEx, bool trimSegments = false,
-    size_t matchGroup = 0);
+std::vector<std::string> split(std::string_view input,
+    const std::string& delimiter, bool trimSegments = false);
 } // namespace libjdx::jdx::utils
 
 #endif // JDX_STRINGUTILS_HPP
@@ -0,0 +1,151 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+libjdx::jdx::util::ThreadPool::ThreadPool(size_t numWorkers)
+    : m_stop{false}
+{
+    m_workers.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; ++i)
+    {
+        m_workers.emplace_back([this]() { runWorker(); });
+    }
+}
+
+libjdx::jdx::util::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+libjdx::jdx::util::ThreadPool& libjdx::jdx::util::ThreadPool::getInstance()
+{
+#ifdef __EMSCRIPTEN__
+    // no threads available by default
+    static ThreadPool pool{0};
+#else
+    static ThreadPool pool{
+        std::max(std::thread::hardware_concurrency(), 1U) - 1U};
+#endif
+    return pool;
+}
+
+size_t libjdx::jdx::util::ThreadPool::getNumThreads() const
+{
+    return m_workers.size() + 1;
+}
+
+void libjdx::jdx::util::ThreadPool::forEach(size_t count, size_t maxThreads,
+    const std::function<void(size_t)>& func)
+{
+    // state shared with helper tasks that may only start after this call
+    // returned
+    struct Batch
+    {
+        std::atomic<size_t> next{0};
+        size_t completed{0};
+        size_t count{0};
+        std::vector<std::exception_ptr> errors;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->count = count;
+    batch->errors.resize(count);
+    // the batch cannot be completed while func is still referenced
+    auto work = [batch, &func]() {
+        size_t index = 0;
+        while ((index = batch->next++) < batch->count)
+        {
+            try
+            {
+                func(index);
+            }
+            catch (...)
+            {
+                batch->errors[index] = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock{batch->mutex};
+            if (++batch->completed == batch->count)
+            {
+                batch->condition.notify_all();
+            }
+        }
+    };
+
+    const auto numHelpers = std::min(
+        {m_workers.size(), count > 0 ? count - 1 : 0, maxThreads - 1});
+    if (maxThreads > 0 && numHelpers > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            for (size_t i = 0; i < numHelpers; ++i)
+            {
+                m_tasks.emplace(work);
+            }
+        }
+        m_condition.notify_all();
+    }
+    // the calling thread takes part, hence completion does not depend on
+    // available workers
+    work();
+    {
+        std::unique_lock<std::mutex> lock{batch->mutex};
+        batch->condition.wait(
+            lock, [&batch]() { return batch->completed == batch->count; });
+    }
+    for (const auto& error : batch->errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void libjdx::jdx::util::ThreadPool::runWorker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_condition.wait(
+                lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,92 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef JDX_THREADPOOL_HPP
+#define JDX_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace libjdx::jdx::util
+{
+/**
+ * @brief A fixed size pool of worker threads.
+ *
+ * Threads waiting for the completion of their work help executing it, so work
+ * may be submitted from within tasks running on the pool without risking a
+ * deadlock. Without worker threads all work is executed by the calling
+ * thread.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Constructs a pool.
+     * @param numWorkers The number of worker threads in addition to the
+     * calling threads.
+     */
+    explicit ThreadPool(size_t numWorkers);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+    ~ThreadPool();
+
+    /**
+     * @brief The library wide pool with one thread per hardware thread
+     * (including the calling thread).
+     * @return The pool.
+     */
+    static ThreadPool& getInstance();
+
+    /**
+     * @brief The number of threads available for executing work.
+     * @return The number of worker threads plus one for the calling thread.
+     */
+    [[nodiscard]] size_t getNumThreads() const;
+
+    /**
+     * @brief Calls a function for each index in [0, count) using at most
+     * maxThreads threads (including the calling thread) and waits for all
+     * calls to complete.
+     * @param count The number of indices.
+     * @param maxThreads The maximum number of threads to use.
+     * @param func The function to call for each index.
+     * @throws The exception thrown by the call with the lowest index, if any.
+     * All other calls are still made.
+     */
+    void forEach(size_t count, size_t maxThreads,
+        const std::function<void(size_t)>& func);
+
+private:
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop;
+
+    void runWorker();
+};
+} // namespace libjdx::jdx::util
+
+#endif // JDX_THREADPOOL_HPP
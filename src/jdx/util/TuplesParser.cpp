@@ -18,6 +18,7 @@
 #include "util/TuplesParser.hpp"
 #include "jdx/ParseException.hpp"
 #include "util/LdrUtils.hpp"
+#include "util/NumberParser.hpp"
 #include "util/StringUtils.hpp"
 
 #include <limits>
@@ -41,20 +42,29 @@ const std::string& libjdx::jdx::util::TuplesParser::getLdrName() const
 
 std::vector<std::optional<std::string>>
 libjdx::jdx::util::TuplesParser::extractTokens(
-    const std::string& tuple, const std::regex& regex, size_t numTokens) const
+    const std::string& tuple, Tokenizer tokenizer, size_t numTokens) const
 {
     auto noCommentTuple = util::stripLineComment(tuple, true).first;
-    std::smatch matches = match(noCommentTuple, regex);
-
-    std::vector<std::optional<std::string>> tokens;
-    for (size_t i = 0; i < numTokens; ++i)
+    std::vector<std::optional<std::string>> tokens(numTokens);
+    tokens.at(0) = noCommentTuple;
+    if (!tokenizer(noCommentTuple, tokens))
     {
-        auto token = extractToken(matches, i);
-        tokens.push_back(token);
+        throw ParseException(
+            "Illegal " + m_ldrName + " tuple: " + noCommentTuple);
     }
     return tokens;
 }
 
+size_t libjdx::jdx::util::TuplesParser::skipSpaces(
+    std::string_view tuple, size_t pos)
+{
+    while (pos < tuple.size() && isSpace(tuple[pos]))
+    {
+        ++pos;
+    }
+    return pos;
+}
+
 void libjdx::jdx::util::TuplesParser::checkForErrors(const std::string& varList,
     const std::multimap<std::string, std::tuple<bool, std::string>>& errorMap,
     const std::string& ldrName)
@@ -79,25 +89,12 @@ void libjdx::jdx::util::TuplesParser::checkForErrors(const std::string& varList,
 double libjdx::jdx::util::TuplesParser::parseDoubleToken(
     const std::optional<std::string>& token)
 {
-    return token.value().empty() ? std::numeric_limits<double>::quiet_NaN()
-                                 : strtod(token.value().data(), nullptr);
-}
-
-std::optional<std::string> libjdx::jdx::util::TuplesParser::extractToken(
-    const std::smatch& matches, size_t index)
-{
-    return matches[index].matched
-               ? std::optional<std::string>{matches[index].str()}
-               : std::nullopt;
-}
-
-std::smatch libjdx::jdx::util::TuplesParser::match(
-    const std::string& tuple, const std::regex& regex) const
-{
-    std::smatch matches;
-    if (!std::regex_match(tuple, matches, regex))
+    if (token.value().empty())
     {
-        throw ParseException("Illegal " + m_ldrName + " tuple: " + tuple);
+        return std::numeric_limits<double>::quiet_NaN();
     }
-    return matches;
+    // lenient as strtod(), i.e., zero for illegal values
+    double value = 0.0;
+    parseDouble(trimView(token.value()), value);
+    return value;
 }
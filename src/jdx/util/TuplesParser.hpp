@@ -20,9 +20,11 @@
 
 #include "io/TextReader.hpp"
 
+#include <functional>
 #include <map>
 #include <optional>
-#include <regex>
+#include <string_view>
+#include <vector>
 
 namespace libjdx::jdx::util
 {
@@ -52,16 +54,35 @@ protected:
      */
     [[nodiscard]] const std::string& getLdrName() const;
 
+    /**
+     * @brief Splits a tuple into tokens.
+     * @param tuple The tuple without comment.
+     * @param tokens The tokens to fill, tokens[0] already holds the full tuple,
+     * all others are nullopt.
+     * @return True if the tuple is well-formed, false otherwise.
+     */
+    using Tokenizer = bool (*)(std::string_view tuple,
+        std::vector<std::optional<std::string>>& tokens);
+
     /**
      * @brief Extracts tokens from a tuple string.
      * @param tuple The tuple.
-     * @param regex Regex extracting tokens into groups.
-     * @param numTokens Number of groups (including 0 == full match) to extract.
+     * @param tokenizer Function extracting the tokens.
+     * @param numTokens Number of tokens (including 0 == full tuple) to extract.
      * @return The extracted tokens.
+     * @throws ParseException If the tuple is malformed.
      */
     [[nodiscard]] std::vector<std::optional<std::string>> extractTokens(
-        const std::string& tuple, const std::regex& regex,
-        size_t numTokens) const;
+        const std::string& tuple, Tokenizer tokenizer, size_t numTokens) const;
+
+    /**
+     * @brief Skips whitespace.
+     * @param tuple The tuple.
+     * @param pos The position to start from.
+     * @return The position of the first non whitespace char at or after pos,
+     * the tuple size if there is none.
+     */
+    static size_t skipSpaces(std::string_view tuple, size_t pos);
 
     /**
      * @brief Checks for errors and throws if a condition is fulfilled.
@@ -89,11 +110,6 @@ protected:
 private:
     const std::string m_variableList;
     const std::string m_ldrName;
-
-    static std::optional<std::string> extractToken(
-        const std::smatch& matches, size_t index);
-    [[nodiscard]] std::smatch match(
-        const std::string& tuple, const std::regex& regex) const;
 };
 
 template<typename R>
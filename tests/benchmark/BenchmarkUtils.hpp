@@ -0,0 +1,362 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef BENCHMARK_BENCHMARKUTILS_HPP
+#define BENCHMARK_BENCHMARKUTILS_HPP
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace libjdx::benchmark
+{
+/**
+ * @brief Generates smooth integer ordinates resembling a spectrum.
+ * @param numPoints The number of points to generate.
+ * @return The ordinates.
+ */
+inline std::vector<int64_t> generateOrdinates(size_t numPoints)
+{
+    std::vector<int64_t> yValues;
+    yValues.reserve(numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        auto x = static_cast<double>(i) / static_cast<double>(numPoints);
+        auto y = 100000.0 * std::sin(40.0 * x) * std::exp(-2.0 * x)
+                 + 500.0 * std::sin(3000.0 * x);
+        yValues.push_back(static_cast<int64_t>(y));
+    }
+    return yValues;
+}
+
+/**
+ * @brief Encodes a value as SQZ (first == true) or DIF (first == false) token.
+ * @param value The value.
+ * @param first Whether to use SQZ (true) or DIF (false) form.
+ * @return The token.
+ */
+inline std::string encodeAsdfToken(int64_t value, bool first)
+{
+    std::string digits = std::to_string(value < 0 ? -value : value);
+    auto leadingDigit = digits.front() - '0';
+    if (first)
+    {
+        digits.front() = value < 0 ? static_cast<char>('`' + leadingDigit)
+                                   : static_cast<char>('@' + leadingDigit);
+    }
+    else if (value == 0)
+    {
+        digits.front() = '%';
+    }
+    else
+    {
+        digits.front() = value < 0 ? static_cast<char>('i' + leadingDigit)
+                                   : static_cast<char>('I' + leadingDigit);
+    }
+    return digits;
+}
+
+/**
+ * @brief Generates (X++(Y..Y)) data lines.
+ * @param numPoints The number of points.
+ * @param dif Whether to use SQZ/DIF (true) or AFFN (false) compression.
+ * @param valuesPerLine The number of ordinates per line.
+ * @return The lines.
+ */
+inline std::vector<std::string> generateXppYYLines(
+    size_t numPoints, bool dif = true, size_t valuesPerLine = 10)
+{
+    auto yValues = generateOrdinates(numPoints);
+    std::vector<std::string> lines;
+    size_t i = 0;
+    while (i < numPoints)
+    {
+        std::string line = std::to_string(i);
+        if (dif)
+        {
+            line += encodeAsdfToken(yValues.at(i), true);
+            size_t j = i + 1;
+            for (; j < numPoints && j < i + valuesPerLine; ++j)
+            {
+                line += encodeAsdfToken(
+                    yValues.at(j) - yValues.at(j - 1), false);
+            }
+            // DIF lines end with a Y check value that is repeated as first
+            // value on the following line
+            if (j < numPoints)
+            {
+                line += encodeAsdfToken(
+                    yValues.at(j) - yValues.at(j - 1), false);
+            }
+            i = j;
+        }
+        else
+        {
+            size_t j = i;
+            for (; j < numPoints && j < i + valuesPerLine; ++j)
+            {
+                line += ' ' + std::to_string(yValues.at(j));
+            }
+            i = j;
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @brief Generates a JCAMP-DX block with (X++(Y..Y)) data.
+ * @param numPoints The number of points.
+ * @param dif Whether to use SQZ/DIF (true) or AFFN (false) compression.
+ * @param valuesPerLine The number of ordinates per line.
+ * @return The block's text.
+ */
+inline std::string generateXyDataBlock(
+    size_t numPoints, bool dif = true, size_t valuesPerLine = 10)
+{
+    auto yValues = generateOrdinates(numPoints);
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark spectrum\n"
+       << "##JCAMP-DX= 4.24\n"
+       << "##DATA TYPE= INFRARED SPECTRUM\n"
+       << "##XUNITS= 1/CM\n"
+       << "##YUNITS= ABSORBANCE\n"
+       << "##XFACTOR= 1.0\n"
+       << "##YFACTOR= 0.001\n"
+       << "##FIRSTX= 0\n"
+       << "##LASTX= " << (numPoints - 1) << "\n"
+       << "##NPOINTS= " << numPoints << "\n"
+       << "##FIRSTY= " << (yValues.empty() ? 0 : yValues.front()) << "\n"
+       << "##XYDATA= (X++(Y..Y))\n";
+    for (const auto& line : generateXppYYLines(numPoints, dif, valuesPerLine))
+    {
+        os << line << "\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief Generates AFFN (XY..XY) lines with non integer values as found in
+ * XYPOINTS and PEAK TABLE records.
+ * @param numPoints The number of xy pairs.
+ * @param pairsPerLine The number of xy pairs per line.
+ * @return The lines.
+ */
+inline std::vector<std::string> generateAffnXyLines(
+    size_t numPoints, size_t pairsPerLine = 5)
+{
+    const auto yValues = generateOrdinates(numPoints);
+    std::vector<std::string> lines;
+    std::array<char, 64> buffer{};
+    std::string line;
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        const auto x = 400.0 + static_cast<double>(i) * 0.0123456789;
+        const auto y = static_cast<double>(yValues.at(i)) * 1.234e-7;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        const auto length = std::snprintf(buffer.data(), buffer.size(),
+            "%.6f, %.9g", x, y);
+        if (!line.empty())
+        {
+            line += "; ";
+        }
+        line.append(buffer.data(), static_cast<size_t>(length));
+        if ((i + 1) % pairsPerLine == 0 || i + 1 == numPoints)
+        {
+            lines.push_back(line);
+            line.clear();
+        }
+    }
+    return lines;
+}
+
+/**
+ * @brief Generates a JCAMP-DX block with AFFN (XY..XY) data.
+ * @param numPoints The number of xy pairs.
+ * @param peakTable Whether to generate a PEAK TABLE (true) or XYPOINTS
+ * (false).
+ * @return The block's text.
+ */
+inline std::string generateXyPairsBlock(size_t numPoints, bool peakTable)
+{
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark "
+       << (peakTable ? "peak table" : "spectrum") << "\n"
+       << "##JCAMP-DX= 4.24\n"
+       << "##DATA TYPE= INFRARED " << (peakTable ? "PEAK TABLE" : "SPECTRUM")
+       << "\n"
+       << "##XUNITS= 1/CM\n"
+       << "##YUNITS= ABSORBANCE\n"
+       << "##XFACTOR= 1.0\n"
+       << "##YFACTOR= 1.0\n"
+       << "##FIRSTX= 400.0\n"
+       << "##LASTX= " << (400.0 + static_cast<double>(numPoints) * 0.0123456789)
+       << "\n"
+       << "##NPOINTS= " << numPoints << "\n"
+       << (peakTable ? "##PEAK TABLE= (XY..XY)\n" : "##XYPOINTS= (XY..XY)\n");
+    for (const auto& line : generateAffnXyLines(numPoints))
+    {
+        os << line << "\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief Generates a JCAMP-DX LINK block with nested (X++(Y..Y)) blocks.
+ * @param numBlocks The number of nested blocks.
+ * @param numPoints The number of points per nested block.
+ * @return The block's text.
+ */
+inline std::string generateLinkBlock(size_t numBlocks, size_t numPoints)
+{
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark link block\n"
+       << "##JCAMP-DX= 4.24\n"
+       << "##DATA TYPE= LINK\n"
+       << "##BLOCKS= " << numBlocks << "\n";
+    const auto nestedBlock = generateXyDataBlock(numPoints);
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        os << nestedBlock;
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief Generates a JCAMP-DX block with many LDRs as found in Bruker exports.
+ * @param numLdrs The number of LDRs in addition to TITLE.
+ * @return The block's text.
+ */
+inline std::string generateManyLdrsBlock(size_t numLdrs)
+{
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark block with many LDRs\n";
+    for (size_t i = 0; i < numLdrs; ++i)
+    {
+        os << "##$PARAM" << i << "= " << i * 7 << "\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief Generates a JCAMP-DX block with many LDRs with long labels and
+ * multi-line array values as found in Bruker exports.
+ * @param numLdrs The number of LDRs in addition to TITLE.
+ * @return The block's text.
+ */
+inline std::string generateLongLdrsBlock(size_t numLdrs)
+{
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark block with long LDRs\n";
+    for (size_t i = 0; i < numLdrs; ++i)
+    {
+        os << "##$ACQUISITION_PARAMETER_" << i << "= (0..15)\n";
+        for (size_t line = 0; line < 2; ++line)
+        {
+            for (size_t value = 0; value < 8; ++value)
+            {
+                os << (i + line * 8 + value) * 1'000'003 << ' ';
+            }
+            os << '\n';
+        }
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief Generates a JCAMP-DX block with an NMR NTUPLES record with
+ * (X++(R..R)) pages.
+ * @param numPages The number of pages.
+ * @param numPoints The number of points per page.
+ * @return The block's text.
+ */
+inline std::string generateNTuplesBlock(size_t numPages, size_t numPoints)
+{
+    std::ostringstream os;
+    os << "##TITLE= Generated benchmark NTUPLES\n"
+       << "##JCAMP-DX= 5.01\n"
+       << "##DATA TYPE= NMR SPECTRUM\n"
+       << "##NTUPLES= NMR SPECTRUM\n"
+       << "##VAR_NAME= FREQUENCY, SPECTRUM, PAGE NUMBER\n"
+       << "##SYMBOL= X, R, N\n"
+       << "##VAR_TYPE= INDEPENDENT, DEPENDENT, PAGE\n"
+       << "##VAR_FORM= AFFN, ASDF, AFFN\n"
+       << "##VAR_DIM= " << numPoints << ", " << numPoints << ", " << numPages
+       << "\n"
+       << "##UNITS= HZ, ARBITRARY UNITS,\n"
+       << "##FIRST= 0, 0, 1\n"
+       << "##LAST= " << (numPoints - 1) << ", 0, " << numPages << "\n"
+       << "##FACTOR= 1, 0.001, 1\n";
+    const auto lines = generateXppYYLines(numPoints, true, 10);
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        os << "##PAGE= N=" << (i + 1) << "\n"
+           << "##NPOINTS= " << numPoints << "\n"
+           << "##DATA TABLE= (X++(R..R)), XYDATA\n";
+        for (const auto& line : lines)
+        {
+            os << line << "\n";
+        }
+    }
+    os << "##END NTUPLES= NMR SPECTRUM\n"
+       << "##END=\n";
+    return os.str();
+}
+
+/**
+ * @brief A file that is removed on destruction.
+ */
+class TemporaryFile
+{
+public:
+    explicit TemporaryFile(const std::string& content)
+        : m_path{"libjdx_benchmark_"
+                 + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".jdx"}
+    {
+        std::ofstream os{m_path, std::ios::binary};
+        os << content;
+    }
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+    TemporaryFile(TemporaryFile&&) = delete;
+    TemporaryFile& operator=(TemporaryFile&&) = delete;
+    ~TemporaryFile()
+    {
+        std::remove(m_path.c_str());
+    }
+    [[nodiscard]] const std::string& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    std::string m_path;
+};
+} // namespace libjdx::benchmark
+
+#endif // BENCHMARK_BENCHMARKUTILS_HPP
@@ -0,0 +1,131 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "jdx/JdxParser.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cstdio>
+#include <string>
+
+namespace
+{
+constexpr size_t s_numBlocks = 500;
+constexpr size_t s_numPoints = 4'000;
+constexpr size_t s_numLdrs = 10'000;
+} // namespace
+
+TEST_CASE("LINK block parsing", "[benchmark][Block]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateLinkBlock(s_numBlocks, s_numPoints)};
+
+    BENCHMARK("parse")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+        return block.getBlocks().size();
+    };
+
+    BENCHMARK("parse in parallel")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(
+            file.getPath(), libjdx::jdx::ParseOptions{false, 0});
+        return block.getBlocks().size();
+    };
+
+    BENCHMARK("parse lazily")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(
+            file.getPath(), libjdx::jdx::ParseOptions{true});
+        return block.getBlocks().size();
+    };
+
+    const libjdx::jdx::ParseOptions indexOptions{true, 1, true};
+    // write index file
+    libjdx::jdx::JdxParser::parse(file.getPath(), indexOptions);
+    BENCHMARK("parse lazily with index file")
+    {
+        auto block
+            = libjdx::jdx::JdxParser::parse(file.getPath(), indexOptions);
+        return block.getBlocks().size();
+    };
+    std::remove((file.getPath() + ".idx").c_str());
+
+    BENCHMARK("parse lazily and list blocks")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(
+            file.getPath(), libjdx::jdx::ParseOptions{true});
+        size_t length = 0;
+        for (const auto& nestedBlock : block.getBlocks())
+        {
+            length
+                += nestedBlock.getLdr("TITLE").value().getValueView().size();
+            length
+                += nestedBlock.getLdr("DATATYPE").value().getValueView().size();
+        }
+        return length;
+    };
+}
+
+TEST_CASE("Block with many LDRs", "[benchmark][Block]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateManyLdrsBlock(s_numLdrs)};
+    auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+
+    BENCHMARK("parse")
+    {
+        return libjdx::jdx::JdxParser::parse(file.getPath()).getLdrs().size();
+    };
+
+    BENCHMARK("getLdr")
+    {
+        size_t length = 0;
+        for (size_t i = 0; i < s_numLdrs; i += 100)
+        {
+            length += block.getLdr("$PARAM" + std::to_string(i))
+                          .value()
+                          .getValueView()
+                          .size();
+        }
+        return length;
+    };
+
+    BENCHMARK("findLdr")
+    {
+        size_t length = 0;
+        for (size_t i = 0; i < s_numLdrs; i += 100)
+        {
+            length += block.findLdr("$PARAM" + std::to_string(i))
+                          ->getValueView()
+                          .size();
+        }
+        return length;
+    };
+}
+
+TEST_CASE("Block with long LDRs", "[benchmark][Block]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateLongLdrsBlock(s_numLdrs)};
+
+    BENCHMARK("parse and destroy")
+    {
+        return libjdx::jdx::JdxParser::parse(file.getPath()).getLdrs().size();
+    };
+}
@@ -0,0 +1,61 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "util/DataParser.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t s_numPoints = 1'000'000;
+
+size_t decodeLines(const std::vector<std::string>& lines, bool isAsdf)
+{
+    size_t numPoints = 0;
+    for (const auto& line : lines)
+    {
+        numPoints += libjdx::jdx::util::DataParser::readValues(line, isAsdf)
+                         .first.size();
+    }
+    return numPoints;
+}
+} // namespace
+
+TEST_CASE("DataParser readValues", "[benchmark][DataParser]")
+{
+    const auto difLines
+        = libjdx::benchmark::generateXppYYLines(s_numPoints, true);
+    const auto affnLines
+        = libjdx::benchmark::generateXppYYLines(s_numPoints, false);
+    // points including one x value per line
+    WARN("SQZ/DIF points: " << decodeLines(difLines, true));
+    WARN("AFFN points: " << decodeLines(affnLines, false));
+
+    BENCHMARK("readValues SQZ/DIF")
+    {
+        return decodeLines(difLines, true);
+    };
+
+    BENCHMARK("readValues AFFN")
+    {
+        return decodeLines(affnLines, false);
+    };
+}
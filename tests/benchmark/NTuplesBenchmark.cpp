@@ -0,0 +1,163 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "jdx/JdxParser.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t s_numPages = 1'000;
+constexpr size_t s_numPoints = 1'000;
+} // namespace
+
+TEST_CASE("NTUPLES parsing", "[benchmark][NTuples]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateNTuplesBlock(s_numPages, s_numPoints)};
+
+    BENCHMARK("parse and count pages")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+        return block.getNTuples().value().getNumPages();
+    };
+
+    BENCHMARK("parse and access last page")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+        const auto& nTuples = block.getNTuples().value();
+        return nTuples.getPage(nTuples.getNumPages() - 1)
+            .getPageVariables()
+            .size();
+    };
+
+    BENCHMARK("parse and access all pages")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+        const auto& nTuples = block.getNTuples().value();
+        size_t length = 0;
+        for (size_t i = 0; i < nTuples.getNumPages(); ++i)
+        {
+            length += nTuples.getPage(i).getPageVariables().size();
+        }
+        return length;
+    };
+}
+
+TEST_CASE("NTUPLES decoding", "[benchmark][NTuples]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateNTuplesBlock(s_numPages, s_numPoints)};
+    auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+    const auto& nTuples = block.getNTuples().value();
+
+    BENCHMARK("getData per page")
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < nTuples.getNumPages(); ++i)
+        {
+            count += nTuples.getPage(i).getDataTable().value().getData().size();
+        }
+        return count;
+    };
+
+    BENCHMARK("decodePages")
+    {
+        size_t count = 0;
+        nTuples.decodePages([&count](size_t, const libjdx::jdx::Page&,
+                                const libjdx::jdx::Spectrum& spectrum) {
+            count += spectrum.size();
+        });
+        return count;
+    };
+
+    BENCHMARK("decodeMatrix (sequential)")
+    {
+        return nTuples.decodeMatrix(1).values.size();
+    };
+
+    BENCHMARK("decodeMatrix (parallel)")
+    {
+        return nTuples.decodeMatrix(0).values.size();
+    };
+}
+
+TEST_CASE("NTUPLES decoding of not yet parsed pages", "[benchmark][NTuples]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateNTuplesBlock(s_numPages, s_numPoints)};
+
+    // only measure decoding, every run needs freshly parsed blocks
+    auto measure = [&file](Catch::Benchmark::Chronometer& meter,
+                       libjdx::io::TextReaderType readerType,
+                       bool singlePass) {
+        libjdx::jdx::ParseOptions options{};
+        options.readerType = readerType;
+        std::vector<libjdx::jdx::Block> blocks;
+        for (int i = 0; i < meter.runs(); ++i)
+        {
+            blocks.push_back(
+                libjdx::jdx::JdxParser::parse(file.getPath(), options));
+        }
+        meter.measure([&blocks, singlePass](int run) {
+            const auto& nTuples = blocks.at(run).getNTuples().value();
+            size_t count = 0;
+            if (singlePass)
+            {
+                nTuples.decodePages([&count](size_t, const libjdx::jdx::Page&,
+                                        const libjdx::jdx::Spectrum& spectrum) {
+                    count += spectrum.size();
+                });
+                return count;
+            }
+            for (size_t i = 0; i < nTuples.getNumPages(); ++i)
+            {
+                const auto& dataTable = nTuples.getPage(i).getDataTable();
+                count += dataTable.value().getSpectrum().size();
+            }
+            return count;
+        });
+    };
+
+    BENCHMARK_ADVANCED("getPage and getSpectrum (MappedTextReader)")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        measure(meter, libjdx::io::TextReaderType::Mapped, false);
+    };
+
+    BENCHMARK_ADVANCED("decodePages (MappedTextReader)")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        measure(meter, libjdx::io::TextReaderType::Mapped, true);
+    };
+
+    BENCHMARK_ADVANCED("getPage and getSpectrum (BufferedTextReader)")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        measure(meter, libjdx::io::TextReaderType::Buffered, false);
+    };
+
+    BENCHMARK_ADVANCED("decodePages (BufferedTextReader)")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        measure(meter, libjdx::io::TextReaderType::Buffered, true);
+    };
+}
@@ -0,0 +1,101 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "jdx/JdxParser.hpp"
+#include "util/NumberParser.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t s_numPoints = 200'000;
+// peak tables are parsed with regular expressions which is much slower
+constexpr size_t s_numPeaks = 20'000;
+
+std::vector<std::string> generateTokens()
+{
+    std::vector<std::string> tokens;
+    for (const auto& line : libjdx::benchmark::generateAffnXyLines(s_numPoints))
+    {
+        size_t start = 0;
+        while (start < line.size())
+        {
+            auto end = line.find_first_of(",;", start);
+            end = end == std::string::npos ? line.size() : end;
+            tokens.push_back(line.substr(start, end - start));
+            start = end + 1;
+            while (start < line.size() && line.at(start) == ' ')
+            {
+                ++start;
+            }
+        }
+    }
+    return tokens;
+}
+} // namespace
+
+TEST_CASE("NumberParser parseDouble", "[benchmark][NumberParser]")
+{
+    const auto tokens = generateTokens();
+
+    BENCHMARK("strtod")
+    {
+        double sum = 0.0;
+        for (const auto& token : tokens)
+        {
+            sum += std::strtod(token.c_str(), nullptr);
+        }
+        return sum;
+    };
+
+    BENCHMARK("parseDouble")
+    {
+        double sum = 0.0;
+        for (const auto& token : tokens)
+        {
+            double value{};
+            libjdx::jdx::util::parseDouble(token, value);
+            sum += value;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("AFFN XYPOINTS and PEAK TABLE", "[benchmark][NumberParser]")
+{
+    libjdx::benchmark::TemporaryFile xyPointsFile{
+        libjdx::benchmark::generateXyPairsBlock(s_numPoints, false)};
+    libjdx::benchmark::TemporaryFile peakTableFile{
+        libjdx::benchmark::generateXyPairsBlock(s_numPeaks, true)};
+
+    BENCHMARK("parse and decode XYPOINTS")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(xyPointsFile.getPath());
+        return block.getXyPoints().value().getData().size();
+    };
+
+    BENCHMARK("parse and decode PEAK TABLE")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(peakTableFile.getPath());
+        return block.getPeakTable().value().getData().size();
+    };
+}
@@ -0,0 +1,216 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "io/BufferedTextReader.hpp"
+#include "io/MappedTextReader.hpp"
+#include "io/SimpleTextReader.hpp"
+#include "io/TextReader.hpp"
+#include "jdx/JdxParser.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t s_numPoints = 2'000'000;
+
+template<typename Reader>
+size_t countLines(Reader& reader)
+{
+    size_t numLines = 0;
+    while (!reader.eof())
+    {
+        numLines += reader.readLine().empty() ? 0 : 1;
+    }
+    return numLines;
+}
+
+template<typename Reader>
+size_t countLineViews(Reader& reader)
+{
+    size_t numLines = 0;
+    reader.seekg(0);
+    while (!reader.eof())
+    {
+        numLines += reader.readLineView().empty() ? 0 : 1;
+    }
+    return numLines;
+}
+
+template<typename Reader>
+size_t countDataLinesWithTellg(Reader& reader)
+{
+    size_t numLines = 0;
+    reader.seekg(0);
+    // skip to data
+    while (reader.readLineView().substr(0, 9) != "##XYDATA=")
+    {
+    }
+    auto pos = reader.tellg();
+    while (reader.readLineView().substr(0, 2) != "##")
+    {
+        pos = reader.tellg();
+        ++numLines;
+    }
+    reader.seekg(pos);
+    return numLines;
+}
+
+template<typename Reader>
+size_t countDataLinesWithUnread(Reader& reader)
+{
+    size_t numLines = 0;
+    reader.seekg(0);
+    // skip to data
+    while (reader.readLineView().substr(0, 9) != "##XYDATA=")
+    {
+    }
+    while (reader.readLineView().substr(0, 2) != "##")
+    {
+        ++numLines;
+    }
+    reader.unreadLine();
+    return numLines;
+}
+} // namespace
+
+TEST_CASE("text reader line reading", "[benchmark][TextReader]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateXyDataBlock(s_numPoints)};
+    const auto& path = file.getPath();
+
+    BENCHMARK("SimpleTextReader")
+    {
+        libjdx::io::SimpleTextReader reader{path};
+        return countLines(reader);
+    };
+
+    BENCHMARK("BufferedTextReader")
+    {
+        libjdx::io::BufferedTextReader reader{path};
+        return countLines(reader);
+    };
+
+    BENCHMARK("BufferedTextReader (read-ahead)")
+    {
+        libjdx::io::BufferedTextReader reader{path, 4 * 1024, true};
+        return countLines(reader);
+    };
+
+    BENCHMARK("MappedTextReader")
+    {
+        libjdx::io::MappedTextReader reader{path};
+        return countLines(reader);
+    };
+}
+
+TEST_CASE("text reader data section lookahead", "[benchmark][TextReader]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateXyDataBlock(s_numPoints)};
+    const auto& path = file.getPath();
+    libjdx::io::SimpleTextReader simpleReader{path};
+    libjdx::io::BufferedTextReader bufferedReader{path};
+
+    BENCHMARK("SimpleTextReader tellg per line")
+    {
+        return countDataLinesWithTellg(simpleReader);
+    };
+
+    BENCHMARK("SimpleTextReader unreadLine")
+    {
+        return countDataLinesWithUnread(simpleReader);
+    };
+
+    BENCHMARK("BufferedTextReader tellg per line")
+    {
+        return countDataLinesWithTellg(bufferedReader);
+    };
+
+    BENCHMARK("BufferedTextReader unreadLine")
+    {
+        return countDataLinesWithUnread(bufferedReader);
+    };
+}
+
+TEST_CASE("text reader dispatch overhead", "[benchmark][TextReader]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateXyDataBlock(s_numPoints)};
+    const auto& path = file.getPath();
+    libjdx::io::MappedTextReader mappedReader{path};
+    libjdx::io::TextReader textReader{
+        std::make_unique<libjdx::io::MappedTextReader>(path)};
+
+    BENCHMARK("MappedTextReader")
+    {
+        return countLineViews(mappedReader);
+    };
+
+    BENCHMARK("TextReader wrapping MappedTextReader")
+    {
+        return countLineViews(textReader);
+    };
+}
+
+TEST_CASE("XYDATA parsing and decoding", "[benchmark][TextReader]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateXyDataBlock(s_numPoints)};
+    const auto& path = file.getPath();
+
+    BENCHMARK("parse and decode")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(path);
+        auto xyData = block.getXyData().value();
+        return xyData.getData().size();
+    };
+}
+
+TEST_CASE("in-memory parsing", "[benchmark][TextReader]")
+{
+    const auto input = libjdx::benchmark::generateXyDataBlock(s_numPoints);
+    auto buffer = std::make_shared<const std::vector<char>>(
+        input.cbegin(), input.cend());
+
+    BENCHMARK("parse from stringstream")
+    {
+        auto streamPtr = std::make_unique<std::stringstream>(input);
+        auto block = libjdx::jdx::JdxParser::parse(std::move(streamPtr));
+        return block.getXyData().has_value();
+    };
+
+    BENCHMARK("parse from copied buffer")
+    {
+        auto block
+            = libjdx::jdx::JdxParser::parse(input.data(), input.size());
+        return block.getXyData().has_value();
+    };
+
+    BENCHMARK("parse from shared buffer")
+    {
+        auto block = libjdx::jdx::JdxParser::parse(buffer);
+        return block.getXyData().has_value();
+    };
+}
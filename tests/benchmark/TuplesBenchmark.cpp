@@ -0,0 +1,129 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/AuditTrail.hpp"
+#include "jdx/PeakAssignments.hpp"
+#include "jdx/PeakTable.hpp"
+#include "util/StringUtils.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+
+namespace
+{
+constexpr size_t s_numLines = 10'000;
+
+std::unique_ptr<libjdx::io::TextReader> createReader(const std::string& input)
+{
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    return std::make_unique<libjdx::io::TextReader>(std::move(streamPtr));
+}
+
+std::string generatePeakTable(size_t numLines)
+{
+    std::ostringstream os;
+    os << "$$ Gauss FWHM = 1\n";
+    for (size_t i = 0; i < numLines; ++i)
+    {
+        // three (XYW..XYW) tuples per line
+        os << i << ".25, " << i * 10 << ".5, 1.0 " << i << ".5,"
+           << i * 10 + 1 << ".5, 1.5; " << i << ".75, " << i * 10 + 2
+           << ".5, 2.0 $$ comment\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+std::string generatePeakAssignments(size_t numLines)
+{
+    std::ostringstream os;
+    os << "$$ Gauss FWHM = 1\n";
+    for (size_t i = 0; i < numLines; ++i)
+    {
+        // one (XYMWA) tuple per line
+        os << "(" << i << ".25, " << i * 10 << ".5, S, 1.5, <peak " << i
+           << ", assigned>)\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+
+std::string generateAuditTrail(size_t numLines)
+{
+    std::ostringstream os;
+    for (size_t i = 0; i < numLines; ++i)
+    {
+        // one 7 parameter entry per line
+        os << "(" << i % 10 << ", <2022-09-01 09:10:11.123 -0200>, <user>,"
+           << " <location>, <process>, <SW 1.3>, <step " << i << ">)\n";
+    }
+    os << "##END=\n";
+    return os.str();
+}
+} // namespace
+
+TEST_CASE("Tuples parsing", "[benchmark][Tuples]")
+{
+    auto peakTableReader = createReader(generatePeakTable(s_numLines));
+    std::optional<std::string> nextLine;
+    libjdx::jdx::PeakTable peakTable{
+        "PEAKTABLE", "(XYW..XYW)", *peakTableReader, nextLine};
+    auto peakAssignmentsReader
+        = createReader(generatePeakAssignments(s_numLines));
+    libjdx::jdx::PeakAssignments peakAssignments{
+        "PEAKASSIGNMENTS", "(XYMWA)", *peakAssignmentsReader, nextLine};
+    auto auditTrailReader = createReader(generateAuditTrail(s_numLines));
+    libjdx::jdx::AuditTrail auditTrail{"AUDITTRAIL",
+        "(NUMBER, WHEN, WHO, WHERE, PROCESS, VERSION, WHAT)", *auditTrailReader,
+        nextLine};
+    const std::string splitInput{"1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0"};
+    // times are for s_numLines lines each
+    WARN("PEAK TABLE peaks: " << peakTable.getData().size());
+    WARN("PEAK ASSIGNMENTS: " << peakAssignments.getData().size());
+    WARN("AUDIT TRAIL entries: " << auditTrail.getData().size());
+
+    BENCHMARK("PEAK TABLE")
+    {
+        return peakTable.getData().size();
+    };
+
+    BENCHMARK("PEAK ASSIGNMENTS")
+    {
+        return peakAssignments.getData().size();
+    };
+
+    BENCHMARK("AUDIT TRAIL")
+    {
+        return auditTrail.getData().size();
+    };
+
+    BENCHMARK("split")
+    {
+        size_t numSegments = 0;
+        for (size_t i = 0; i < s_numLines; ++i)
+        {
+            numSegments
+                += libjdx::jdx::util::split(splitInput, ",", true).size();
+        }
+        return numSegments;
+    };
+}
@@ -0,0 +1,72 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "BenchmarkUtils.hpp"
+#include "jdx/DecodeCache.hpp"
+#include "jdx/JdxParser.hpp"
+#include "jdx/ParallelDecoding.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t s_numPoints = 2'000'000;
+} // namespace
+
+TEST_CASE("XYDATA decoding", "[benchmark][XyData]")
+{
+    libjdx::benchmark::TemporaryFile file{
+        libjdx::benchmark::generateXyDataBlock(s_numPoints)};
+    auto block = libjdx::jdx::JdxParser::parse(file.getPath());
+    const auto& xyData = block.getXyData().value();
+    std::vector<double> x(s_numPoints);
+    std::vector<double> y(s_numPoints);
+
+    BENCHMARK("getData")
+    {
+        auto data = xyData;
+        return data.getData().size();
+    };
+
+    BENCHMARK("getSpectrum")
+    {
+        return xyData.getSpectrum().size();
+    };
+
+    BENCHMARK("decodeInto")
+    {
+        return xyData.decodeInto(x.data(), y.data(), s_numPoints);
+    };
+
+    libjdx::jdx::ParallelDecoding::setNumThreads(0);
+    BENCHMARK("getSpectrum (parallel)")
+    {
+        return xyData.getSpectrum().size();
+    };
+    libjdx::jdx::ParallelDecoding::setNumThreads(1);
+
+    auto& cache = libjdx::jdx::DecodeCache::getInstance();
+    cache.setMemoryBudget(256 * 1024 * 1024);
+    BENCHMARK("getSpectrum (cached)")
+    {
+        return xyData.getSpectrum().size();
+    };
+    cache.setMemoryBudget(0);
+}
@@ -72,6 +72,27 @@ TEST_CASE("BufferedTextReader reads data", "[BufferedTextReader]")
         REQUIRE("line 2" == reader.readLine());
     }
 
+    SECTION("reads line views", "[BufferedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "\n"
+                          "line 4"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::BufferedTextReader reader{std::move(streamPtr), 5};
+
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE(8 == reader.tellg());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        REQUIRE(31 == reader.tellg());
+        REQUIRE(reader.readLineView().empty());
+        REQUIRE("line 4" == reader.readLineView());
+        REQUIRE(reader.eof());
+        reader.seekg(8);
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+    }
+
     SECTION("throws when trying to read past end", "[BufferedTextReader]")
     {
         std::string input{};
@@ -81,4 +102,58 @@ TEST_CASE("BufferedTextReader reads data", "[BufferedTextReader]")
 
         REQUIRE_THROWS(reader.readLine());
     }
+
+    SECTION("unreads last line", "[BufferedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "line 3"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::BufferedTextReader reader{std::move(streamPtr), 5};
+
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        reader.unreadLine();
+        REQUIRE(8 == reader.tellg());
+        // only the last line can be unread
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 2 spanning chunks" == reader.readLine());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+        reader.unreadLine();
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE("line 3" == reader.readLine());
+        reader.seekg(8);
+        REQUIRE_THROWS(reader.unreadLine());
+    }
+
+    SECTION("reads ahead in background", "[BufferedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning multiple chunks\n"
+                          "line 3\n"
+                          "line 4 also spanning multiple chunks"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::BufferedTextReader reader{std::move(streamPtr), 4, true};
+
+        REQUIRE(static_cast<std::streamoff>(input.size())
+                == reader.getLength());
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE("line 2 spanning multiple chunks" == reader.readLineView());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE("line 4 also spanning multiple chunks" == reader.readLine());
+        REQUIRE(reader.eof());
+        REQUIRE_THROWS(reader.readLine());
+
+        reader.seekg(40);
+        REQUIRE("line 3" == reader.readLine());
+        reader.seekg(2);
+        REQUIRE("ne 1" == reader.readLine());
+        reader.seekg(-9, std::ios_base::end);
+        REQUIRE("le chunks" == reader.readLine());
+        REQUIRE(reader.eof());
+    }
 }
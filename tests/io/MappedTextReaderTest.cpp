@@ -0,0 +1,233 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "io/MappedTextReader.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("MappedTextReader reads data", "[MappedTextReader]")
+{
+    SECTION("reads file specified by path", "[MappedTextReader]")
+    {
+        const std::string path{"resources/dummy.txt"};
+        libjdx::io::MappedTextReader reader{path};
+
+        REQUIRE(0 == reader.tellg());
+        REQUIRE(20 == reader.getLength());
+        REQUIRE(0 == reader.tellg());
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE("not a JCAMP-DX file" == reader.readLine());
+        REQUIRE(reader.eof());
+        REQUIRE(20 == reader.tellg());
+        reader.seekg(1);
+        REQUIRE(1 == reader.tellg());
+    }
+
+    SECTION("reads data provided by an istream", "[MappedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2\n"
+                          "line 3"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE(0 == reader.tellg());
+        REQUIRE(21 == reader.getLength());
+        REQUIRE(0 == reader.tellg());
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE("line 1" == reader.readLine());
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE(8 == reader.tellg());
+        REQUIRE("line 2" == reader.readLine());
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE(15 == reader.tellg());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+        REQUIRE(21 == reader.tellg());
+        reader.seekg(1);
+        REQUIRE(1 == reader.tellg());
+        reader.seekg(21);
+        REQUIRE(21 == reader.tellg());
+        reader.seekg(8);
+        REQUIRE("line 2" == reader.readLine());
+        reader.seekg(-6, std::ios_base::end);
+        REQUIRE("line 3" == reader.readLine());
+        reader.seekg(-13, std::ios_base::cur);
+        REQUIRE("line 2" == reader.readLine());
+    }
+
+    SECTION("reads empty lines", "[MappedTextReader]")
+    {
+        std::string input{"\n"
+                          "\r\n"
+                          "line 3\n"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE(reader.readLine().empty());
+        REQUIRE(reader.readLine().empty());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+    }
+
+    SECTION("reads line views", "[MappedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "\n"
+                          "line 4"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE(8 == reader.tellg());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        REQUIRE(31 == reader.tellg());
+        REQUIRE(reader.readLineView().empty());
+        REQUIRE("line 4" == reader.readLineView());
+        REQUIRE(reader.eof());
+        reader.seekg(8);
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+    }
+
+    SECTION("throws when trying to read past end", "[MappedTextReader]")
+    {
+        std::string input{};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE(reader.eof());
+        REQUIRE_THROWS(reader.readLine());
+    }
+
+    SECTION("throws when seeking outside of data", "[MappedTextReader]")
+    {
+        std::string input{"line 1"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE_THROWS(reader.seekg(7));
+        REQUIRE_THROWS(reader.seekg(-1));
+        REQUIRE(0 == reader.tellg());
+    }
+
+    SECTION("throws for non existing file", "[MappedTextReader]")
+    {
+        const std::string path{"resources/non_existing.txt"};
+
+        REQUIRE_THROWS(libjdx::io::MappedTextReader{path});
+    }
+
+    SECTION("unreads last line", "[MappedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "line 3"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::MappedTextReader reader{std::move(streamPtr)};
+
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        reader.unreadLine();
+        REQUIRE(8 == reader.tellg());
+        // only the last line can be unread
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 2 spanning chunks" == reader.readLine());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+        reader.unreadLine();
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE("line 3" == reader.readLine());
+        reader.seekg(8);
+        REQUIRE_THROWS(reader.unreadLine());
+    }
+
+    SECTION("reads shared buffer without copying", "[MappedTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2"};
+        auto buffer
+            = std::make_shared<const std::vector<char>>(input.cbegin(),
+                input.cend());
+        auto reader = std::make_unique<libjdx::io::MappedTextReader>(buffer);
+        auto cursor = reader->createCursor();
+        reader.reset();
+
+        REQUIRE(14 == cursor->getLength());
+        REQUIRE(buffer->data() == cursor->readLineView().data());
+        buffer.reset();
+        // cursor keeps buffer alive
+        REQUIRE("line 2" == cursor->readLineView());
+        REQUIRE(cursor->eof());
+    }
+
+    SECTION("throws for null buffer", "[MappedTextReader]")
+    {
+        std::shared_ptr<const std::vector<char>> buffer{};
+
+        REQUIRE_THROWS_AS(
+            libjdx::io::MappedTextReader{buffer}, std::invalid_argument);
+    }
+
+#if defined(__linux__) || defined(__APPLE__)
+    SECTION("throws when seeking in truncated file", "[MappedTextReader]")
+    {
+        const std::string path{"mapped_test_truncated.txt"};
+        {
+            std::ofstream os{path, std::ios::binary};
+            os << "line 1\nline 2\n";
+        }
+        libjdx::io::MappedTextReader reader{path};
+        REQUIRE("line 1" == reader.readLine());
+        {
+            // truncate
+            std::ofstream os{path, std::ios::binary | std::ios::trunc};
+        }
+
+        REQUIRE_THROWS_AS(reader.seekg(0), std::runtime_error);
+
+        std::remove(path.c_str());
+    }
+#endif
+
+#ifdef __linux__
+    SECTION("reads virtual files that report zero size", "[MappedTextReader]")
+    {
+        const std::string path{"/proc/self/status"};
+        REQUIRE(libjdx::io::MappedTextReader::isMappingSafe(path));
+        libjdx::io::MappedTextReader reader{path};
+
+        REQUIRE(0 < reader.getLength());
+        REQUIRE(0 == reader.readLine().rfind("Name:", 0));
+    }
+#endif
+}
@@ -71,6 +71,27 @@ TEST_CASE("SimpleTextReader reads data", "[SimpleTextReader]")
         REQUIRE("line 2" == reader.readLine());
     }
 
+    SECTION("reads line views", "[SimpleTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "\n"
+                          "line 4"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::SimpleTextReader reader{std::move(streamPtr)};
+
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE(8 == reader.tellg());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        REQUIRE(31 == reader.tellg());
+        REQUIRE(reader.readLineView().empty());
+        REQUIRE("line 4" == reader.readLineView());
+        REQUIRE(reader.eof());
+        reader.seekg(8);
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+    }
+
     SECTION("throws when trying to read past end", "[SimpleTextReader]")
     {
         std::string input{};
@@ -80,4 +101,30 @@ TEST_CASE("SimpleTextReader reads data", "[SimpleTextReader]")
 
         REQUIRE_THROWS(reader.readLine());
     }
+
+    SECTION("unreads last line", "[SimpleTextReader]")
+    {
+        std::string input{"line 1\r\n"
+                          "line 2 spanning chunks\n"
+                          "line 3"};
+        auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        libjdx::io::SimpleTextReader reader{std::move(streamPtr)};
+
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE("line 2 spanning chunks" == reader.readLineView());
+        reader.unreadLine();
+        REQUIRE(8 == reader.tellg());
+        // only the last line can be unread
+        REQUIRE_THROWS(reader.unreadLine());
+        REQUIRE("line 2 spanning chunks" == reader.readLine());
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+        reader.unreadLine();
+        REQUIRE_FALSE(reader.eof());
+        REQUIRE("line 3" == reader.readLine());
+        reader.seekg(8);
+        REQUIRE_THROWS(reader.unreadLine());
+    }
 }
@@ -0,0 +1,130 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "io/TextReader.hpp"
+#include "io/BufferedTextReader.hpp"
+#include "io/SimpleTextReader.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+std::unique_ptr<std::stringstream> createStream(const std::string& input)
+{
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    return streamPtr;
+}
+} // namespace
+
+TEST_CASE("TextReader reads data", "[TextReader]")
+{
+    const std::string input{"line 1\r\n"
+                            "line 2\n"
+                            "line 3"};
+
+    SECTION("reads file specified by path", "[TextReader]")
+    {
+        const std::string path{"resources/dummy.txt"};
+        libjdx::io::TextReader reader{path};
+
+        REQUIRE(20 == reader.getLength());
+        REQUIRE("not a JCAMP-DX file" == reader.readLine());
+        REQUIRE(reader.eof());
+    }
+
+#ifdef __linux__
+    SECTION("reads file that can not be mapped", "[TextReader]")
+    {
+        libjdx::io::TextReader reader{"/proc/self/status"};
+
+        REQUIRE(0 < reader.getLength());
+        REQUIRE(0 == reader.readLine().rfind("Name:", 0));
+    }
+#endif
+
+    SECTION("reads data with default reader", "[TextReader]")
+    {
+        libjdx::io::TextReader reader{createStream(input)};
+
+        REQUIRE(21 == reader.getLength());
+        REQUIRE("line 1" == reader.readLineView());
+        REQUIRE(8 == reader.tellg());
+        reader.unreadLine();
+        REQUIRE("line 1" == reader.readLine());
+        REQUIRE("line 2" == reader.readLine());
+        reader.seekg(-6, std::ios_base::end);
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+        REQUIRE_THROWS(reader.readLine());
+    }
+
+    SECTION("reads data with specific reader", "[TextReader]")
+    {
+        libjdx::io::TextReader reader{
+            std::make_unique<libjdx::io::SimpleTextReader>(
+                createStream(input))};
+
+        REQUIRE(21 == reader.getLength());
+        REQUIRE("line 1" == reader.readLineView());
+        reader.seekg(15);
+        REQUIRE("line 3" == reader.readLine());
+        REQUIRE(reader.eof());
+    }
+
+    SECTION("throws for null reader", "[TextReader]")
+    {
+        std::unique_ptr<libjdx::io::BufferedTextReader> readerPtr{};
+
+        REQUIRE_THROWS(libjdx::io::TextReader{std::move(readerPtr)});
+    }
+}
+
+TEST_CASE("TextReader creates cursors", "[TextReader]")
+{
+    const std::string input{"line 1\n"
+                            "line 2"};
+
+    SECTION("creates cursors if supported by reader", "[TextReader]")
+    {
+        libjdx::io::TextReader reader{createStream(input)};
+        REQUIRE("line 1" == reader.readLine());
+
+#ifndef __EMSCRIPTEN__
+        REQUIRE(reader.canCreateCursor());
+        auto cursor = reader.createCursor();
+        REQUIRE(0 == cursor->tellg());
+        REQUIRE("line 1" == cursor->readLine());
+        REQUIRE("line 2" == cursor->readLine());
+        REQUIRE(7 == reader.tellg());
+#endif
+    }
+
+    SECTION("throws if not supported by reader", "[TextReader]")
+    {
+        libjdx::io::TextReader reader{
+            std::make_unique<libjdx::io::BufferedTextReader>(
+                createStream(input))};
+
+        REQUIRE_FALSE(reader.canCreateCursor());
+        REQUIRE_THROWS(reader.createCursor());
+    }
+}
@@ -0,0 +1,60 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/Arena.hpp"
+#include "util/ThreadPool.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("allocates strings from arena", "[Arena]")
+{
+    libjdx::jdx::util::Arena arena;
+    libjdx::jdx::util::Arena otherArena;
+    std::string text{"a text that is longer than a small string"};
+
+    std::pmr::string arenaText{text, &arena};
+    arenaText += arenaText;
+
+    REQUIRE(text + text == std::string_view{arenaText});
+    REQUIRE(arena.is_equal(arena));
+    REQUIRE_FALSE(arena.is_equal(otherArena));
+    REQUIRE_FALSE(arena.is_equal(*std::pmr::get_default_resource()));
+}
+
+TEST_CASE("allocates from multiple threads", "[Arena]")
+{
+    libjdx::jdx::util::Arena arena;
+    libjdx::jdx::util::ThreadPool pool{3};
+    std::vector<std::string_view> texts(1000);
+
+    pool.forEach(texts.size(), 4, [&arena, &texts](size_t index) {
+        auto* text = static_cast<char*>(arena.allocate(64, 1));
+        std::fill_n(text, 64, static_cast<char>('a' + index % 26));
+        texts[index] = std::string_view{text, 64};
+    });
+
+    for (size_t i = 0; i < texts.size(); ++i)
+    {
+        REQUIRE(std::string(64, static_cast<char>('a' + i % 26)) == texts[i]);
+    }
+}
@@ -19,7 +19,12 @@
 
 #include "catch2/catch.hpp"
 
+#include <atomic>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 TEST_CASE("parses all LDRs in block with XYDATA", "[Block]")
 {
@@ -55,12 +60,12 @@ TEST_CASE("parses all LDRs in block with XYDATA", "[Block]")
     // does NOT contain "##END=" even though technically an LDR
     // does NOT contain "##XYDATA=" as it's available through specialized member
     REQUIRE(14 == ldrs.size());
-    REQUIRE("Test" == block.getLdr("TITLE").value().getValue());
-    REQUIRE(
-        "Dummy" == block.getLdr("SPECTROMETERDATASYSTEM").value().getValue());
+    REQUIRE("Test" == block.getLdr("TITLE").value().getValueView());
+    REQUIRE("Dummy"
+            == block.getLdr("SPECTROMETERDATASYSTEM").value().getValueView());
     REQUIRE(true == block.getXyData().has_value());
-    REQUIRE(
-        "Dummy" == block.getLdr("Spectrometer/DATA SYSTEM").value().getValue());
+    REQUIRE("Dummy"
+            == block.getLdr("Spectrometer/DATA SYSTEM").value().getValueView());
     REQUIRE(true == block.getXyData().has_value());
     auto data = block.getXyData().value();
     REQUIRE(2 == data.getData().size());
@@ -128,7 +133,7 @@ TEST_CASE("parses all LDRs in block with RADATA", "[Block]")
     // does NOT contain "##END=" even though technically an LDR
     // does NOT contain "##RADATA=" as it's available through specialized member
     REQUIRE(13 == ldrs.size());
-    REQUIRE("Test" == block.getLdr("TITLE").value().getValue());
+    REQUIRE("Test" == block.getLdr("TITLE").value().getValueView());
     REQUIRE(block.getRaData().has_value());
     auto data = block.getRaData().value();
     REQUIRE(2 == data.getData().size());
@@ -356,7 +361,7 @@ TEST_CASE("parses LINK block", "[Block]")
     // does NOT contain "##END=" even though technically an LDR
     // does NOT contain nested block LDRs
     REQUIRE(4 == ldrs.size());
-    REQUIRE("Root LINK BLOCK" == block.getLdr("TITLE").value().getValue());
+    REQUIRE("Root LINK BLOCK" == block.getLdr("TITLE").value().getValueView());
     REQUIRE_FALSE(block.getXyData().has_value());
     REQUIRE_FALSE(block.getRaData().has_value());
     REQUIRE_FALSE(block.getXyPoints().has_value());
@@ -428,13 +433,13 @@ TEST_CASE("parses nested blocks", "[Block]")
 
     // does not contain "##END=" even though technically an LDR
     REQUIRE(4 == ldrs.size());
-    REQUIRE("Test Link Block" == block.getLdr("TITLE").value().getValue());
-    REQUIRE("LINK" == block.getLdr("DATATYPE").value().getValue());
+    REQUIRE("Test Link Block" == block.getLdr("TITLE").value().getValueView());
+    REQUIRE("LINK" == block.getLdr("DATATYPE").value().getValueView());
 
     REQUIRE(1 == innerBlocks.size());
     const auto& innerBlock = innerBlocks.at(0);
-    REQUIRE(
-        "Test Nested Block" == innerBlock.getLdr("TITLE").value().getValue());
+    REQUIRE("Test Nested Block"
+            == innerBlock.getLdr("TITLE").value().getValueView());
 }
 
 TEST_CASE("treats block comments different from other LDRs", "[Block]")
@@ -497,7 +502,58 @@ TEST_CASE("does not throw on duplicate generic LDRs with same content in block",
     libjdx::io::TextReader reader{std::move(streamPtr)};
 
     libjdx::jdx::Block block{reader};
-    REQUIRE("4.24" == block.getLdr("JCAMP-DX").value().getValue());
+    REQUIRE("4.24" == block.getLdr("JCAMP-DX").value().getValueView());
+}
+
+TEST_CASE("finds LDRs in block with many LDRs by any label spelling",
+    "[Block]")
+{
+    constexpr size_t numLdrs = 1'000;
+    std::string input{"##TITLE= Test Block\r\n"};
+    for (size_t i = 0; i < numLdrs; ++i)
+    {
+        input += "##$PARAM_" + std::to_string(i) + "= " + std::to_string(i)
+                 + "\r\n";
+    }
+    input += "##$PARAM_7= 7\r\n"
+             "##END=";
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    libjdx::jdx::Block block{reader};
+    // the identical duplicate is kept
+    REQUIRE(numLdrs + 2 == block.getLdrs().size());
+    REQUIRE("Test Block" == block.getLdr("title").value().getValueView());
+    REQUIRE("0" == block.getLdr("$PARAM0").value().getValueView());
+    REQUIRE("7" == block.getLdr("$param 7").value().getValueView());
+    REQUIRE("999" == block.getLdr("$PARAM-999").value().getValueView());
+    REQUIRE_FALSE(block.getLdr("$PARAM1000").has_value());
+}
+
+TEST_CASE("LDRs copied from block outlive block", "[Block]")
+{
+    std::string input{"##TITLE= Test Block with a title longer than a small "
+                      "string\r\n"
+                      "##$LONG_USER_DEFINED_LABEL= multi line\r\n"
+                      "value\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    {
+        auto block = libjdx::jdx::Block{
+            std::make_unique<libjdx::io::TextReader>(std::move(streamPtr))};
+        ldrs = block.getLdrs();
+    }
+
+    REQUIRE(2 == ldrs.size());
+    REQUIRE("TITLE" == ldrs.at(0).getLabelView());
+    REQUIRE("Test Block with a title longer than a small string"
+            == ldrs.at(0).getValueView());
+    REQUIRE("$LONGUSERDEFINEDLABEL" == ldrs.at(1).getLabelView());
+    REQUIRE("multi line\nvalue" == ldrs.at(1).getValueView());
 }
 
 TEST_CASE("throws on missing END LDR in block", "[Block]")
@@ -583,3 +639,240 @@ TEST_CASE("parses block with AUDIT TRAIL", "[Block]")
     const auto& auditTrail = block.getAuditTrail().value();
     REQUIRE(2 == auditTrail.getData().size());
 }
+
+TEST_CASE("parses nested blocks lazily", "[Block]")
+{
+    std::string input{"##TITLE= Test Link Block\r\n"
+                      "##JCAMP-DX= 4.24\r\n"
+                      "##DATA TYPE= LINK\r\n"
+                      "##BLOCKS= 1\r\n"
+
+                      "##TITLE= Test Nested Block\r\n"
+                      "##JCAMP-DX= 4.24\r\n"
+                      "##DATA TYPE= INFRARED SPECTRUM\r\n"
+                      "##XUNITS= 1/CM\r\n"
+                      "##YUNITS= ABSORBANCE\r\n"
+                      "##XFACTOR= 1.0\r\n"
+                      "##YFACTOR= 1.0\r\n"
+                      "##FIRSTX= 450\r\n"
+                      "##LASTX= 451\r\n"
+                      "##NPOINTS= 2\r\n"
+                      "##XYPOINTS= (XY..XY)\r\n"
+                      "450.0, 10.0\r\n"
+                      "451.0, 11.0\r\n"
+                      "##END=\r\n"
+
+                      "##= comment\r\n"
+                      "##ORIGIN= devrosch\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    auto block = libjdx::jdx::Block(reader, libjdx::jdx::ParseOptions{true});
+
+    REQUIRE("Test Link Block" == block.getLdr("TITLE").value().getValueView());
+    REQUIRE("devrosch" == block.getLdr("ORIGIN").value().getValueView());
+    REQUIRE_FALSE(block.getLdr("OWNER").has_value());
+    REQUIRE(1 == block.getBlocks().size());
+    const auto& innerBlock = block.getBlocks().at(0);
+    REQUIRE("INFRARED SPECTRUM"
+            == innerBlock.getLdr("DATA TYPE").value().getValueView());
+    REQUIRE_FALSE(innerBlock.getLdr("OWNER").has_value());
+
+    const auto& ldrs = block.getLdrs();
+    REQUIRE(5 == ldrs.size());
+    REQUIRE("BLOCKS" == ldrs.at(3).getLabelView());
+    REQUIRE("ORIGIN" == ldrs.at(4).getLabelView());
+    REQUIRE(std::vector<std::string>{"comment"} == block.getLdrComments());
+    REQUIRE(10 == innerBlock.getLdrs().size());
+    const auto& xyPoints = innerBlock.getXyPoints();
+    REQUIRE(xyPoints.has_value());
+    auto data = xyPoints.value().getData();
+    REQUIRE(2 == data.size());
+    REQUIRE(451.0 == Approx(data.at(1).first));
+    REQUIRE(11.0 == Approx(data.at(1).second));
+}
+
+TEST_CASE("parses LDRs preceding data lazily without parsing block", "[Block]")
+{
+    std::string input{"##TITLE= Test Block\r\n"
+                      "##JCAMP-DX= 4.24\r\n"
+                      "##DATA TYPE= INFRARED PEAK TABLE\r\n"
+                      "##PEAK TABLE= (XY..XY)\r\n"
+                      "450.0, 10.0\r\n"
+                      "##JCAMP-DX= 5.00\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    auto block = libjdx::jdx::Block(reader, libjdx::jdx::ParseOptions{true});
+
+    REQUIRE("4.24" == block.getLdr("JCAMP-DX").value().getValueView());
+    REQUIRE("INFRARED PEAK TABLE"
+            == block.getLdr("DATATYPE").value().getValueView());
+    // LDRs following data require parsing the block
+    REQUIRE_THROWS_AS(block.getLdr("ORIGIN"), libjdx::jdx::BlockParseException);
+    REQUIRE_THROWS_AS(block.getLdrs(), libjdx::jdx::BlockParseException);
+}
+
+TEST_CASE("finds LDRs without copying them", "[Block]")
+{
+    std::string input{"##TITLE= Test Block\r\n"
+                      "##JCAMP-DX= 4.24\r\n"
+                      "##DATA TYPE= INFRARED PEAK TABLE\r\n"
+                      "##PEAK TABLE= (XY..XY)\r\n"
+                      "450.0, 10.0\r\n"
+                      "##END="};
+    auto isLazy = GENERATE(false, true);
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    auto block = libjdx::jdx::Block(reader, libjdx::jdx::ParseOptions{isLazy});
+
+    const auto* ldr = block.findLdr("data type");
+    REQUIRE(ldr != nullptr);
+    REQUIRE("DATATYPE" == ldr->getLabelView());
+    REQUIRE("INFRARED PEAK TABLE" == ldr->getValueView());
+    // repeated lookups yield the same LDR
+    REQUIRE(ldr == block.findLdr("DATATYPE"));
+    REQUIRE("4.24" == block.findLdr("JCAMP-DX")->getValueView());
+    REQUIRE(nullptr == block.findLdr("ORIGIN"));
+    REQUIRE_FALSE(block.getLdr("ORIGIN").has_value());
+}
+
+TEST_CASE("throws on missing END LDR in lazily parsed block", "[Block]")
+{
+    std::string input{"##TITLE= Test Block\r\n"
+                      "##JCAMP-DX= 5.00\r\n"
+                      "##TITLE= Nested Block\r\n"
+                      "##END=\r\n"};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    REQUIRE_THROWS_WITH(
+        libjdx::jdx::Block(reader, libjdx::jdx::ParseOptions{true}),
+        Catch::Matchers::Contains("Test Block"));
+}
+
+#ifndef __EMSCRIPTEN__
+TEST_CASE("parses and decodes nested blocks concurrently", "[Block]")
+{
+    auto isLazy = GENERATE(false, true);
+    constexpr size_t numBlocks = 8;
+    constexpr size_t numLines = 200;
+    constexpr size_t numThreads = 8;
+    constexpr size_t numIterations = 20;
+
+    std::string input{"##TITLE= Test Link Block\r\n"
+                      "##JCAMP-DX= 4.24\r\n"
+                      "##DATA TYPE= LINK\r\n"
+                      "##BLOCKS= 8\r\n"};
+    for (size_t block = 0; block < numBlocks; ++block)
+    {
+        const auto offset = std::to_string(block * 1000);
+        input += "##TITLE= Test Nested Block " + std::to_string(block) + "\r\n"
+                 + "##JCAMP-DX= 4.24\r\n"
+                 + "##DATA TYPE= INFRARED SPECTRUM\r\n"
+                 + "##XUNITS= 1/CM\r\n"
+                 + "##YUNITS= ABSORBANCE\r\n"
+                 + "##XFACTOR= 1.0\r\n"
+                 + "##YFACTOR= 1.0\r\n"
+                 + "##FIRSTX= 0\r\n"
+                 + "##LASTX= " + std::to_string(2 * numLines - 1) + "\r\n"
+                 + "##NPOINTS= " + std::to_string(2 * numLines) + "\r\n"
+                 + "##XYDATA= (X++(Y..Y))\r\n";
+        for (size_t line = 0; line < numLines; ++line)
+        {
+            input += std::to_string(2 * line) + " " + offset + " "
+                     + std::to_string(line) + "\r\n";
+        }
+        input += "##PEAK TABLE= (XY..XY)\r\n";
+        for (size_t line = 0; line < numLines; ++line)
+        {
+            input += std::to_string(line) + ", " + offset + "\r\n";
+        }
+        input += "##END=\r\n";
+    }
+    input += "##END=";
+    auto createReader = [&input]() {
+        auto streamPtr
+            = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        return libjdx::io::TextReader{std::move(streamPtr)};
+    };
+    auto expectedReader = createReader();
+    auto expectedBlock = libjdx::jdx::Block(expectedReader);
+    auto reader = createReader();
+    auto block = libjdx::jdx::Block(reader, libjdx::jdx::ParseOptions{isLazy});
+    const auto& blocks = block.getBlocks();
+    REQUIRE(numBlocks == blocks.size());
+
+    std::vector<std::vector<std::pair<double, double>>> expectedXyData;
+    std::vector<std::vector<double>> expectedPeakYs;
+    for (const auto& nestedBlock : expectedBlock.getBlocks())
+    {
+        expectedXyData.push_back(
+            nestedBlock.getXyData()->getSpectrum().toPairs());
+        std::vector<double> peakYs;
+        for (const auto& peak : nestedBlock.getPeakTable()->getData())
+        {
+            peakYs.push_back(peak.y);
+        }
+        expectedPeakYs.push_back(std::move(peakYs));
+    }
+    REQUIRE(2 * numLines == expectedXyData.at(1).size());
+    REQUIRE(1000.0 == expectedXyData.at(1).at(0).second);
+    REQUIRE(numLines == expectedPeakYs.at(1).size());
+    const auto readerPos = reader.tellg();
+
+    // Catch2 assertions are not thread-safe => count mismatches
+    std::atomic<size_t> numMismatches{0};
+    auto decode = [&](size_t threadIndex) {
+        for (size_t i = 0; i < numIterations; ++i)
+        {
+            // threads access the same and different records at the same time
+            const auto index = (threadIndex + i) % numBlocks;
+            const auto& nestedBlock = blocks.at(index);
+            // lazily parsed blocks are parsed on first access
+            const auto* title = nestedBlock.findLdr("TITLE");
+            if (title == nullptr
+                || title->getValueView()
+                       != "Test Nested Block " + std::to_string(index)
+                || nestedBlock.getLdrs().size() != 10)
+            {
+                ++numMismatches;
+            }
+            if (nestedBlock.getXyData()->getSpectrum().toPairs()
+                != expectedXyData.at(index))
+            {
+                ++numMismatches;
+            }
+            std::vector<double> peakYs;
+            for (const auto& peak : nestedBlock.getPeakTable()->getData())
+            {
+                peakYs.push_back(peak.y);
+            }
+            if (peakYs != expectedPeakYs.at(index))
+            {
+                ++numMismatches;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(decode, t);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(0 == numMismatches);
+    REQUIRE(readerPos == reader.tellg());
+}
+#endif
@@ -46,6 +46,9 @@ TEST_CASE("parses Bruker $RELAX section with arbitrary content",
 
     REQUIRE("file_name_1" == brukerRelaxSection.getName());
     REQUIRE("1.0\n0.0 1.0 2.0\n   123   \n" == brukerRelaxSection.getContent());
+    REQUIRE("file_name_1" == brukerRelaxSection.getNameView());
+    REQUIRE("1.0\n0.0 1.0 2.0\n   123   \n"
+            == brukerRelaxSection.getContentView());
 }
 
 TEST_CASE("parses Bruker $RELAX section with JCAMP-DX like content",
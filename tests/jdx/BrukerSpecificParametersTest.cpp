@@ -47,14 +47,21 @@ TEST_CASE("parses regular Bruker parameters section",
     REQUIRE("Bruker specific parameters" == brukerParameterSection.getName());
     auto content = brukerParameterSection.getContent();
     REQUIRE(4 == content.size());
-    REQUIRE("$DU" == content.at(0).getLabel());
-    REQUIRE("<C:/>" == content.at(0).getValue());
-    REQUIRE("$NAME" == content.at(1).getLabel());
-    REQUIRE("<Jul11-2023>" == content.at(1).getValue());
-    REQUIRE("$AQSEQ" == content.at(2).getLabel());
-    REQUIRE("0" == content.at(2).getValue());
-    REQUIRE("$AQMOD" == content.at(3).getLabel());
-    REQUIRE("3" == content.at(3).getValue());
+    REQUIRE("$DU" == content.at(0).getLabelView());
+    REQUIRE("<C:/>" == content.at(0).getValueView());
+    REQUIRE("$NAME" == content.at(1).getLabelView());
+    REQUIRE("<Jul11-2023>" == content.at(1).getValueView());
+    REQUIRE("$AQSEQ" == content.at(2).getLabelView());
+    REQUIRE("0" == content.at(2).getValueView());
+    REQUIRE("$AQMOD" == content.at(3).getLabelView());
+    REQUIRE("3" == content.at(3).getValueView());
+    // non-copying accessors
+    REQUIRE("Bruker specific parameters"
+            == brukerParameterSection.getNameView());
+    const auto& ldrs = brukerParameterSection.getLdrs();
+    REQUIRE(4 == ldrs.size());
+    REQUIRE(&ldrs == &brukerParameterSection.getLdrs());
+    REQUIRE("<Jul11-2023>" == ldrs.at(1).getValueView());
 }
 
 TEST_CASE("parses Bruker parameters section for F1",
@@ -85,16 +92,16 @@ TEST_CASE("parses Bruker parameters section for F1",
             == brukerParameterSection.getName());
     auto content = brukerParameterSection.getContent();
     REQUIRE(3 == content.size());
-    REQUIRE("$AMP" == content.at(0).getLabel());
+    REQUIRE("$AMP" == content.at(0).getLabelView());
     REQUIRE("(0..31)\n"
             "100 100 100 100 100 100 100 100 100 100 100 100 100 100 100 100 "
             "100 100 \n"
             "100 100 100 100 100 100 100 100 100 100 100 100 100 100 "
-            == content.at(0).getValue());
-    REQUIRE("$AQSEQ" == content.at(1).getLabel());
-    REQUIRE("0" == content.at(1).getValue());
-    REQUIRE("$AQMOD" == content.at(2).getLabel());
-    REQUIRE("2" == content.at(2).getValue());
+            == content.at(0).getValueView());
+    REQUIRE("$AQSEQ" == content.at(1).getLabelView());
+    REQUIRE("0" == content.at(1).getValueView());
+    REQUIRE("$AQMOD" == content.at(2).getLabelView());
+    REQUIRE("2" == content.at(2).getValueView());
 }
 
 TEST_CASE("fails on premature end of Bruker parameters section",
@@ -0,0 +1,117 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/CharClassifier.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+using libjdx::jdx::util::CharClassifier;
+using libjdx::jdx::util::CharClassMasks;
+
+std::vector<CharClassifier::Kernel> getSupportedKernels()
+{
+    std::vector<CharClassifier::Kernel> kernels{CharClassifier::Kernel::Scalar};
+    if (CharClassifier::getKernel() == CharClassifier::Kernel::Avx2)
+    {
+        kernels.push_back(CharClassifier::Kernel::Sse42);
+    }
+    if (CharClassifier::getKernel() != CharClassifier::Kernel::Scalar)
+    {
+        kernels.push_back(CharClassifier::getKernel());
+    }
+    return kernels;
+}
+
+void requireEqual(const CharClassMasks& expect, const CharClassMasks& actual)
+{
+    REQUIRE(expect.delimiter == actual.delimiter);
+    REQUIRE(expect.digit == actual.digit);
+    REQUIRE(expect.sqz == actual.sqz);
+    REQUIRE(expect.dif == actual.dif);
+    REQUIRE(expect.dup == actual.dup);
+    REQUIRE(expect.sign == actual.sign);
+    REQUIRE(expect.exponent == actual.exponent);
+    REQUIRE(expect.missing == actual.missing);
+}
+} // namespace
+
+TEST_CASE("classifies chars", "[util][CharClassifier]")
+{
+    std::string input{"1A2 j%?\tS,s;+-Ee.x"};
+
+    for (auto kernel : getSupportedKernels())
+    {
+        auto masks = CharClassifier::classify(input, kernel);
+
+        REQUIRE(0b1010'1000'1000ULL == masks.delimiter);
+        REQUIRE(0b0101ULL == masks.digit);
+        REQUIRE(0b1100'0000'0000'0010ULL == masks.sqz);
+        REQUIRE(0b0011'0000ULL == masks.dif);
+        REQUIRE(0b0101'0000'0000ULL == masks.dup);
+        REQUIRE(0b0011'0000'0000'0000ULL == masks.sign);
+        REQUIRE(0b1100'0000'0000'0000ULL == masks.exponent);
+        REQUIRE(0b0100'0000ULL == masks.missing);
+    }
+}
+
+TEST_CASE(
+    "all kernels classify all chars identically", "[util][CharClassifier]")
+{
+    std::string input{};
+    for (int c = 0; c < 256; ++c)
+    {
+        input += static_cast<char>(c);
+    }
+
+    for (size_t offset = 0; offset < input.size();
+         offset += CharClassifier::s_blockSize)
+    {
+        // odd block sizes to also cover partial chunks
+        auto block = std::string_view{input}.substr(offset, 61);
+        auto expect
+            = CharClassifier::classify(block, CharClassifier::Kernel::Scalar);
+        for (auto kernel : getSupportedKernels())
+        {
+            requireEqual(expect, CharClassifier::classify(block, kernel));
+        }
+    }
+}
+
+TEST_CASE("provides masks for line positions", "[util][LineClassifier]")
+{
+    std::string input(100, 'x');
+    input.at(70) = ' ';
+    input.at(99) = ';';
+    libjdx::jdx::util::LineClassifier classifier{input};
+
+    size_t blockStart = 0;
+    size_t blockSize = 0;
+    auto masks = classifier.getMasks(10, blockStart, blockSize);
+    REQUIRE(0 == blockStart);
+    REQUIRE(64 == blockSize);
+    REQUIRE(0 == masks.delimiter);
+
+    masks = classifier.getMasks(66, blockStart, blockSize);
+    REQUIRE(64 == blockStart);
+    REQUIRE(36 == blockSize);
+    REQUIRE(((1ULL << 6U) | (1ULL << 35U)) == masks.delimiter);
+}
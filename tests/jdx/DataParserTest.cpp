@@ -15,13 +15,129 @@
  * You should have received a copy of the GNU Lesser General Public License
  * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
  */
+#include "jdx/ParseException.hpp"
 #include "util/DataParser.hpp"
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <istream>
 #include <sstream>
 
+namespace
+{
+std::string encodeAsdf(int64_t value, const char* positive,
+    const char* negative)
+{
+    auto digits = std::to_string(value < 0 ? -value : value);
+    const auto leadingDigit = digits.front() - '0';
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    digits.front()
+        = value < 0 ? negative[leadingDigit] : positive[leadingDigit];
+    return digits;
+}
+
+std::string encodeSqz(int64_t value)
+{
+    return encodeAsdf(value, "@ABCDEFGHI", "@abcdefghi");
+}
+
+std::string encodeDif(int64_t value)
+{
+    return encodeAsdf(value, "%JKLMNOPQR", "%jklmnopqr");
+}
+
+/**
+ * @brief Generates (X++(Y..Y)) lines mixing DIF lines with y check, DUP
+ * tokens, AFFN lines, missing values, and comment only lines.
+ */
+std::vector<std::string> generateMixedXppYYLines(size_t numLines)
+{
+    uint64_t state = 12345;
+    auto random = [&state](uint64_t max) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (state >> 33) % max;
+    };
+    std::vector<std::string> lines;
+    int64_t y = 0;
+    for (size_t i = 0; i < numLines; ++i)
+    {
+        auto line = std::to_string(i * 10);
+        const auto kind = random(20);
+        if (kind == 0)
+        {
+            lines.emplace_back("$$ comment only");
+            continue;
+        }
+        if (kind == 1)
+        {
+            // AFFN line, first value duplicates last value of previous line
+            line += " " + std::to_string(y) + " ? 2.25 7";
+            y = 7;
+            lines.push_back(line);
+            continue;
+        }
+        line += encodeSqz(y);
+        for (size_t j = 0; j < 10; ++j)
+        {
+            const auto dif = static_cast<int64_t>(random(2001)) - 1000;
+            y += dif;
+            line += encodeDif(dif);
+            if (dif != 0 && random(8) == 0)
+            {
+                // repeat DIF
+                y += dif;
+                line += "T";
+            }
+        }
+        if (kind == 2)
+        {
+            // missing last value => no y check
+            line += "?";
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+std::string joinLines(const std::vector<std::string>& lines)
+{
+    std::string input;
+    for (const auto& line : lines)
+    {
+        input += line + "\r\n";
+    }
+    return input + "##END=";
+}
+
+std::vector<double> readXppYYData(const std::string& input, size_t numThreads)
+{
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+    auto values = libjdx::jdx::util::DataParser::readXppYYData(
+        reader, 0.1, numThreads);
+    REQUIRE(std::string{"##END="} == reader.readLine());
+    return values;
+}
+
+std::string getXppYYDataError(const std::string& input, size_t numThreads)
+{
+    try
+    {
+        readXppYYData(input, numThreads);
+    }
+    catch (const libjdx::jdx::ParseException& e)
+    {
+        return e.what();
+    }
+    return "";
+}
+} // namespace
+
 TEST_CASE("parses AFFN data line", "[DataParser]")
 {
     std::string input{"1.23 4.5E23 4.5e2 7.89E-14 600 1E2"};
@@ -118,6 +234,31 @@ TEST_CASE("parses DIF data line", "[DataParser]")
     }
 }
 
+TEST_CASE("parses SQZ/DIF/DUP tokens with decimals and multiple digits",
+    "[DataParser]")
+{
+    std::string input{"A.5J.25T b1234567890123456789012 +12345678901234567890"};
+
+    auto [actual, difEncoded]
+        = libjdx::jdx::util::DataParser::readValues(input, true);
+    auto expect = std::vector<double>{
+        1.5, 2.75, 4.0, -21234567890123456789012.0, 12345678901234567890.0};
+
+    REQUIRE(false == difEncoded);
+    REQUIRE(expect.size() == actual.size());
+    for (size_t i{0}; i < expect.size(); i++)
+    {
+        REQUIRE((expect.at(i) == Approx(actual.at(i))));
+    }
+}
+
+TEST_CASE("fails for illegal numeric token", "[DataParser]")
+{
+    std::string input{"1 + 2"};
+
+    REQUIRE_THROWS(libjdx::jdx::util::DataParser::readValues(input, false));
+}
+
 TEST_CASE("fails if sequence starts with DIF token", "[DataParser]")
 {
     std::string input{"jjj"};
@@ -222,3 +363,81 @@ TEST_CASE("parses DIFDUP stream", "[DataParser]")
         REQUIRE((expect.at(i) == Approx(actual.at(i))));
     }
 }
+
+TEST_CASE("accumulates DIF values exactly and applies y factor",
+    "[DataParser]")
+{
+    // 2^53 + 1 cannot be represented as double, accumulating in double would
+    // get stuck at 2^53 and yield 2^53 - 2 as last value
+    std::string input{"1.5 9007199254740992 J J J k\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    auto actual = libjdx::jdx::util::DataParser::readXppYYData(reader, 0.5);
+    // exact values 2^53, 2^53 + 1, 2^53 + 2, 2^53 + 3, 2^53 + 1 are rounded
+    // only when converted to double
+    auto expect = std::vector<double>{4503599627370496.0, 4503599627370496.0,
+        4503599627370497.0, 4503599627370498.0, 4503599627370496.0};
+
+    REQUIRE(expect == actual);
+}
+
+TEST_CASE("decodes (X++(Y..Y)) data in parallel bit identical to sequential",
+    "[DataParser]")
+{
+    const auto input = joinLines(generateMixedXppYYLines(3000));
+
+    const auto expect = readXppYYData(input, 1);
+    REQUIRE(std::any_of(expect.cbegin(), expect.cend(),
+        [](double value) { return std::isnan(value); }));
+
+    for (size_t numThreads : {2, 3, 7, 0})
+    {
+        const auto actual = readXppYYData(input, numThreads);
+        REQUIRE(expect.size() == actual.size());
+        REQUIRE(0
+                == std::memcmp(expect.data(), actual.data(),
+                    expect.size() * sizeof(double)));
+    }
+}
+
+TEST_CASE("decodes small (X++(Y..Y)) data in parallel", "[DataParser]")
+{
+    std::string input{
+        "599.860@VKT%TLkj%J%KLJ%njKjL%kL%jJULJ%kLK1%lLMNPNPRLJ0QTOJ1P\r\n"
+        "700.158A28\r\n"
+        "##END="};
+
+    REQUIRE(readXppYYData(input, 1) == readXppYYData(input, 4));
+}
+
+TEST_CASE("detects failing Y check at chunk border when decoding in parallel",
+    "[DataParser]")
+{
+    auto lines = generateMixedXppYYLines(3000);
+    // chunk borders for 4 threads are at lines 750, 1500, and 2250
+    lines.at(1499) = "14990@1J";
+    lines.at(1500) = "15000A5J";
+
+    const auto input = joinLines(lines);
+    const auto expect = getXppYYDataError(input, 1);
+
+    REQUIRE_FALSE(expect.empty());
+    REQUIRE(expect == getXppYYDataError(input, 4));
+}
+
+TEST_CASE("reports first error when decoding in parallel", "[DataParser]")
+{
+    auto lines = generateMixedXppYYLines(3000);
+    lines.at(1600) = "16000@1J";
+    lines.at(1601) = "16010A5J";
+    lines.at(2400) = "24000 x";
+
+    const auto input = joinLines(lines);
+    const auto expect = getXppYYDataError(input, 1);
+
+    REQUIRE(expect.find("Y value check failed") != std::string::npos);
+    REQUIRE(expect == getXppYYDataError(input, 4));
+}
@@ -0,0 +1,232 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/DecodeCache.hpp"
+#include "jdx/StringLdr.hpp"
+#include "jdx/XyData.hpp"
+#include "jdx/XyPoints.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <sstream>
+
+namespace
+{
+/**
+ * @brief Sets the cache budget for the scope of a test and restores the
+ * disabled default afterwards.
+ */
+class CacheBudgetGuard
+{
+public:
+    explicit CacheBudgetGuard(size_t budget)
+    {
+        libjdx::jdx::DecodeCache::getInstance().clear();
+        libjdx::jdx::DecodeCache::getInstance().setMemoryBudget(budget);
+    }
+    CacheBudgetGuard(const CacheBudgetGuard&) = delete;
+    CacheBudgetGuard& operator=(const CacheBudgetGuard&) = delete;
+    CacheBudgetGuard(CacheBudgetGuard&&) = delete;
+    CacheBudgetGuard& operator=(CacheBudgetGuard&&) = delete;
+    ~CacheBudgetGuard()
+    {
+        libjdx::jdx::DecodeCache::getInstance().setMemoryBudget(0);
+    }
+};
+
+std::unique_ptr<std::stringstream> createStream(const std::string& input)
+{
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    return streamPtr;
+}
+
+std::vector<libjdx::jdx::StringLdr> createXyDataLdrs()
+{
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "450.0");
+    ldrs.emplace_back("LASTX", "452.0");
+    ldrs.emplace_back("XFACTOR", "1.0");
+    ldrs.emplace_back("YFACTOR", "1.0");
+    ldrs.emplace_back("NPOINTS", "3");
+    return ldrs;
+}
+
+libjdx::jdx::XyData createXyData(libjdx::io::TextReader& reader)
+{
+    auto nextLine = std::optional<std::string>{};
+    return libjdx::jdx::XyData(
+        "XYDATA", "(X++(Y..Y))", createXyDataLdrs(), reader, nextLine);
+}
+
+const std::string s_xppYYInput{"450.0 10.0 11.0 12.0\r\n"
+                               "##END="};
+} // namespace
+
+TEST_CASE("is disabled by default", "[DecodeCache]")
+{
+    auto& cache = libjdx::jdx::DecodeCache::getInstance();
+
+    REQUIRE(0 == cache.getMemoryBudget());
+    REQUIRE(0 == cache.getMemoryUsage());
+}
+
+TEST_CASE("does not cache data if disabled", "[DecodeCache]")
+{
+    CacheBudgetGuard guard{0};
+    libjdx::io::TextReader reader{createStream(s_xppYYInput)};
+    auto xyData = createXyData(reader);
+
+    auto spectrum0 = xyData.getSpectrum();
+    auto spectrum1 = xyData.getSpectrum();
+
+    REQUIRE(0 == libjdx::jdx::DecodeCache::getInstance().getMemoryUsage());
+    REQUIRE(spectrum0.getYValues() == spectrum1.getYValues());
+    REQUIRE(spectrum0.getYValues().data() != spectrum1.getYValues().data());
+}
+
+TEST_CASE("shares decoded data between reads if enabled", "[DecodeCache]")
+{
+    CacheBudgetGuard guard{1024 * 1024};
+    auto& cache = libjdx::jdx::DecodeCache::getInstance();
+    libjdx::io::TextReader reader{createStream(s_xppYYInput)};
+    auto xyData = createXyData(reader);
+
+    auto spectrum0 = xyData.getSpectrum();
+    REQUIRE(0 < cache.getMemoryUsage());
+    auto spectrum1 = xyData.getSpectrum();
+
+    REQUIRE(spectrum0.getYValues().data() == spectrum1.getYValues().data());
+    REQUIRE(3 == spectrum1.size());
+    REQUIRE(450.0 == Approx(spectrum1.getX(0)));
+    REQUIRE(12.0 == Approx(spectrum1.getY(2)));
+    // pairs are created from cached data
+    auto data = xyData.getData();
+    REQUIRE(3 == data.size());
+    REQUIRE(452.0 == Approx(data.at(2).first));
+    REQUIRE(12.0 == Approx(data.at(2).second));
+}
+
+TEST_CASE("shares decoded data between copies of a record", "[DecodeCache]")
+{
+    CacheBudgetGuard guard{1024 * 1024};
+    auto& cache = libjdx::jdx::DecodeCache::getInstance();
+    libjdx::io::TextReader reader{createStream(s_xppYYInput)};
+    auto xyData = std::make_optional(createXyData(reader));
+    auto xyDataCopy = std::make_optional(xyData.value());
+
+    auto spectrum0 = xyData->getSpectrum();
+    auto spectrum1 = xyDataCopy->getSpectrum();
+
+    REQUIRE(spectrum0.getYValues().data() == spectrum1.getYValues().data());
+    const auto usage = cache.getMemoryUsage();
+    REQUIRE(0 < usage);
+
+    xyData.reset();
+    REQUIRE(usage == cache.getMemoryUsage());
+    xyDataCopy.reset();
+    // cached data removed once the last copy is gone
+    REQUIRE(0 == cache.getMemoryUsage());
+    // data remains valid for callers
+    REQUIRE(3 == spectrum0.size());
+    REQUIRE(11.0 == Approx(spectrum0.getY(1)));
+}
+
+TEST_CASE("evicts least recently used data", "[DecodeCache]")
+{
+    auto& cache = libjdx::jdx::DecodeCache::getInstance();
+    libjdx::io::TextReader reader0{createStream(s_xppYYInput)};
+    libjdx::io::TextReader reader1{createStream(s_xppYYInput)};
+    libjdx::io::TextReader reader2{createStream(s_xppYYInput)};
+    auto xyData0 = createXyData(reader0);
+    auto xyData1 = createXyData(reader1);
+    auto xyData2 = createXyData(reader2);
+
+    // determine size of one cached data set
+    CacheBudgetGuard guard{1024 * 1024};
+    auto spectrum0 = xyData0.getSpectrum();
+    const auto size = cache.getMemoryUsage();
+    cache.clear();
+
+    // room for two data sets
+    cache.setMemoryBudget(2 * size);
+    spectrum0 = xyData0.getSpectrum();
+    auto spectrum1 = xyData1.getSpectrum();
+    REQUIRE(2 * size == cache.getMemoryUsage());
+    // mark data 0 as most recently used
+    REQUIRE(spectrum0.getYValues().data()
+            == xyData0.getSpectrum().getYValues().data());
+    // evicts data 1
+    auto spectrum2 = xyData2.getSpectrum();
+    REQUIRE(2 * size == cache.getMemoryUsage());
+
+    REQUIRE(spectrum0.getYValues().data()
+            == xyData0.getSpectrum().getYValues().data());
+    REQUIRE(spectrum2.getYValues().data()
+            == xyData2.getSpectrum().getYValues().data());
+    REQUIRE(spectrum1.getYValues().data()
+            != xyData1.getSpectrum().getYValues().data());
+
+    // reducing the budget evicts data
+    cache.setMemoryBudget(size);
+    REQUIRE(size == cache.getMemoryUsage());
+    cache.setMemoryBudget(size - 1);
+    REQUIRE(0 == cache.getMemoryUsage());
+}
+
+TEST_CASE("does not cache data exceeding the budget", "[DecodeCache]")
+{
+    CacheBudgetGuard guard{1};
+    libjdx::io::TextReader reader{createStream(s_xppYYInput)};
+    auto xyData = createXyData(reader);
+
+    auto spectrum = xyData.getSpectrum();
+
+    REQUIRE(3 == spectrum.size());
+    REQUIRE(0 == libjdx::jdx::DecodeCache::getInstance().getMemoryUsage());
+}
+
+TEST_CASE("caches (XY..XY) data", "[DecodeCache]")
+{
+    CacheBudgetGuard guard{1024 * 1024};
+    std::string input{"450.0, 10.0; 451.0, 11.0\r\n"
+                      "##END="};
+    libjdx::io::TextReader reader{createStream(input)};
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "450.0");
+    ldrs.emplace_back("LASTX", "451.0");
+    ldrs.emplace_back("XFACTOR", "1.0");
+    ldrs.emplace_back("YFACTOR", "1.0");
+    ldrs.emplace_back("NPOINTS", "2");
+    auto nextLine = std::optional<std::string>{};
+    auto xyPoints = libjdx::jdx::XyPoints(
+        "XYPOINTS", "(XY..XY)", ldrs, reader, nextLine);
+
+    auto spectrum0 = xyPoints.getSpectrum();
+    auto spectrum1 = xyPoints.getSpectrum();
+
+    REQUIRE(spectrum0.getExplicitXValues().data()
+            == spectrum1.getExplicitXValues().data());
+    REQUIRE(spectrum0.getYValues().data() == spectrum1.getYValues().data());
+    REQUIRE(2 == spectrum1.size());
+    REQUIRE(451.0 == Approx(spectrum1.getX(1)));
+    REQUIRE(11.0 == Approx(spectrum1.getY(1)));
+}
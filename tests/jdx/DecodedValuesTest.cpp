@@ -0,0 +1,68 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/DecodedValues.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cmath>
+#include <limits>
+
+TEST_CASE("keeps integer values as integers", "[util][DecodedValues]")
+{
+    libjdx::jdx::util::DecodedValues values{};
+    values.push(libjdx::jdx::util::DecodedValue::fromInteger(1));
+    values.push(libjdx::jdx::util::DecodedValue::add(values.back(),
+        libjdx::jdx::util::DecodedValue::fromInteger(-3)));
+
+    REQUIRE(values.isInteger());
+    REQUIRE(2 == values.size());
+    REQUIRE(-2 == values.back().integer);
+    REQUIRE(std::vector<double>{10.0, -20.0} == values.toDoubles(10.0));
+}
+
+TEST_CASE("switches to double for non integer values", "[util][DecodedValues]")
+{
+    libjdx::jdx::util::DecodedValues values{};
+    values.push(libjdx::jdx::util::DecodedValue::fromInteger(1));
+    values.push(libjdx::jdx::util::DecodedValue::fromDouble(0.5));
+    values.push(libjdx::jdx::util::DecodedValue::fromDouble(
+        std::numeric_limits<double>::quiet_NaN()));
+
+    REQUIRE_FALSE(values.isInteger());
+    REQUIRE(3 == values.size());
+    REQUIRE(1.0 == values.at(0).toDouble());
+    auto doubles = values.toDoubles(2.0);
+    REQUIRE(2.0 == doubles.at(0));
+    REQUIRE(1.0 == doubles.at(1));
+    REQUIRE(std::isnan(doubles.at(2)));
+
+    values.clear();
+    values.push(libjdx::jdx::util::DecodedValue::fromInteger(1));
+    REQUIRE(values.isInteger());
+}
+
+TEST_CASE("falls back to double on integer overflow", "[util][DecodedValues]")
+{
+    auto sum = libjdx::jdx::util::DecodedValue::add(
+        libjdx::jdx::util::DecodedValue::fromInteger(
+            std::numeric_limits<int64_t>::max()),
+        libjdx::jdx::util::DecodedValue::fromInteger(1));
+
+    REQUIRE_FALSE(sum.isInteger);
+    REQUIRE(9223372036854775808.0 == sum.toDouble());
+}
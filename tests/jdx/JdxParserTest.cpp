@@ -21,8 +21,15 @@
 #include "catch2/catch.hpp"
 
 #include <array>
+#include <atomic>
 #include <climits>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE("accepts legal file", "[JdxParser]")
 {
@@ -76,3 +83,395 @@ TEST_CASE("parse throws for illegal file", "[JdxParser]")
 
     REQUIRE_THROWS(libjdx::jdx::JdxParser::parse(std::move(istream)));
 }
+
+namespace
+{
+void requireEqualBlocks(
+    const libjdx::jdx::Block& expected, const libjdx::jdx::Block& actual)
+{
+    REQUIRE(expected.getLdrs().size() == actual.getLdrs().size());
+    for (size_t i = 0; i < expected.getLdrs().size(); ++i)
+    {
+        REQUIRE(expected.getLdrs().at(i).getLabelView()
+                == actual.getLdrs().at(i).getLabelView());
+        REQUIRE(expected.getLdrs().at(i).getValueView()
+                == actual.getLdrs().at(i).getValueView());
+    }
+    REQUIRE(expected.getLdrComments() == actual.getLdrComments());
+    REQUIRE(expected.getXyData().has_value() == actual.getXyData().has_value());
+    if (expected.getXyData().has_value())
+    {
+        REQUIRE(expected.getXyData()->getSpectrum().toPairs()
+                == actual.getXyData()->getSpectrum().toPairs());
+    }
+    REQUIRE(expected.getRaData().has_value() == actual.getRaData().has_value());
+    REQUIRE(expected.getXyPoints().has_value()
+            == actual.getXyPoints().has_value());
+    REQUIRE(expected.getPeakTable().has_value()
+            == actual.getPeakTable().has_value());
+    REQUIRE(expected.getNTuples().has_value()
+            == actual.getNTuples().has_value());
+    if (expected.getNTuples().has_value())
+    {
+        REQUIRE(expected.getNTuples()->getNumPages()
+                == actual.getNTuples()->getNumPages());
+    }
+    REQUIRE(expected.getBrukerSpecificParameters().size()
+            == actual.getBrukerSpecificParameters().size());
+    REQUIRE(expected.getBrukerRelaxSections().size()
+            == actual.getBrukerRelaxSections().size());
+    REQUIRE(expected.getBlocks().size() == actual.getBlocks().size());
+    for (size_t i = 0; i < expected.getBlocks().size(); ++i)
+    {
+        requireEqualBlocks(
+            expected.getBlocks().at(i), actual.getBlocks().at(i));
+    }
+}
+} // namespace
+
+TEST_CASE("lazy parse yields same result as regular parse", "[JdxParser]")
+{
+    for (const std::string path :
+        {"resources/CompoundFile.jdx", "resources/SimpleFile.jdx",
+            "resources/Bruker_specific.jdx",
+            "resources/Bruker_specific_relax.jdx"})
+    {
+        auto expected = libjdx::jdx::JdxParser::parse(path);
+        auto actual = libjdx::jdx::JdxParser::parse(
+            path, libjdx::jdx::ParseOptions{true});
+
+        requireEqualBlocks(expected, actual);
+    }
+}
+
+TEST_CASE("parallel parse yields same result as regular parse", "[JdxParser]")
+{
+    for (const std::string path :
+        {"resources/CompoundFile.jdx", "resources/SimpleFile.jdx",
+            "resources/Bruker_specific.jdx"})
+    {
+        auto expected = libjdx::jdx::JdxParser::parse(path);
+        for (size_t numThreads : {0, 2, 4})
+        {
+            auto actual = libjdx::jdx::JdxParser::parse(
+                path, libjdx::jdx::ParseOptions{false, numThreads});
+
+            requireEqualBlocks(expected, actual);
+        }
+    }
+}
+
+TEST_CASE("parse yields same result for all reader types", "[JdxParser]")
+{
+    using libjdx::io::TextReaderType;
+    for (const std::string path :
+        {"resources/CompoundFile.jdx", "resources/SimpleFile.jdx"})
+    {
+        auto expected = libjdx::jdx::JdxParser::parse(path);
+        for (auto readerType : {TextReaderType::Mapped,
+                 TextReaderType::Buffered, TextReaderType::Simple})
+        {
+            libjdx::jdx::ParseOptions options{};
+            options.readerType = readerType;
+            // parallel parsing falls back to sequential parsing for readers
+            // without cursors
+            options.numThreads = 2;
+            auto actual = libjdx::jdx::JdxParser::parse(path, options);
+
+            requireEqualBlocks(expected, actual);
+        }
+    }
+}
+
+TEST_CASE("parse from memory yields same result as regular parse",
+    "[JdxParser]")
+{
+    for (const std::string path :
+        {"resources/CompoundFile.jdx", "resources/SimpleFile.jdx"})
+    {
+        auto expected = libjdx::jdx::JdxParser::parse(path);
+        std::ifstream stream{path, std::ios::binary};
+        auto buffer = std::make_shared<const std::vector<char>>(
+            std::istreambuf_iterator<char>{stream},
+            std::istreambuf_iterator<char>{});
+
+        auto copied
+            = libjdx::jdx::JdxParser::parse(buffer->data(), buffer->size());
+        requireEqualBlocks(expected, copied);
+
+        auto shared = libjdx::jdx::JdxParser::parse(
+            buffer, libjdx::jdx::ParseOptions{true});
+        // the block keeps the buffer alive for lazy parsing and decoding
+        buffer.reset();
+        requireEqualBlocks(expected, shared);
+    }
+}
+
+TEST_CASE("data records decode after block and buffer are destroyed",
+    "[JdxParser]")
+{
+    const std::string path{"resources/CompoundFile.jdx"};
+    auto expected = libjdx::jdx::JdxParser::parse(path);
+    const auto& expectedBlocks = expected.getBlocks();
+
+    std::optional<libjdx::jdx::XyData> xyData;
+    std::optional<libjdx::jdx::PeakTable> peakTable;
+    std::optional<libjdx::jdx::DataTable> dataTable;
+    {
+        std::ifstream stream{path, std::ios::binary};
+        auto buffer = std::make_shared<const std::vector<char>>(
+            std::istreambuf_iterator<char>{stream},
+            std::istreambuf_iterator<char>{});
+        auto block = libjdx::jdx::JdxParser::parse(buffer);
+        buffer.reset();
+
+        const auto& blocks = block.getBlocks();
+        xyData.emplace(blocks.at(0).getXyData().value());
+        peakTable.emplace(blocks.at(4).getPeakTable().value());
+        dataTable.emplace(
+            blocks.at(3).getNTuples()->getPage(0).getDataTable().value());
+    }
+
+    REQUIRE(xyData->getSpectrum().toPairs()
+            == expectedBlocks.at(0).getXyData()->getSpectrum().toPairs());
+
+    auto expectedPeaks = expectedBlocks.at(4).getPeakTable()->getData();
+    auto peaks = peakTable->getData();
+    REQUIRE(peaks.size() == expectedPeaks.size());
+    for (size_t i = 0; i < peaks.size(); ++i)
+    {
+        REQUIRE(peaks.at(i).x == expectedPeaks.at(i).x);
+        REQUIRE(peaks.at(i).y == expectedPeaks.at(i).y);
+    }
+
+    const auto& expectedDataTable
+        = expectedBlocks.at(3).getNTuples()->getPage(0).getDataTable();
+    REQUIRE(dataTable->getData() == expectedDataTable->getData());
+}
+
+TEST_CASE("parallel parse reports same error as regular parse", "[JdxParser]")
+{
+    const std::string input{"##TITLE= Link Block\n"
+                            "##JCAMP-DX= 5.00\n"
+                            "##BLOCKS= 2\n"
+                            "##TITLE= Block 1\n"
+                            "##JCAMP-DX= 5.00\n"
+                            "##END=\n"
+                            "##TITLE= Block 2\n"
+                            "##JCAMP-DX= 5.00\n"
+                            "##JCAMP-DX= 4.24\n"
+                            "##END=\n"
+                            "##END=\n"};
+    auto parse = [&input](size_t numThreads) {
+        auto streamPtr = std::make_unique<std::stringstream>(input);
+        return libjdx::jdx::JdxParser::parse(
+            std::move(streamPtr), libjdx::jdx::ParseOptions{false, numThreads});
+    };
+
+    std::string expected;
+    try
+    {
+        parse(1);
+    }
+    catch (const std::exception& e)
+    {
+        expected = e.what();
+    }
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE_THROWS_WITH(parse(4), expected);
+}
+
+TEST_CASE("lazy parse with index file yields same result as regular parse",
+    "[JdxParser]")
+{
+    const std::string path{"index_test_compound.jdx"};
+    const std::string indexPath{path + ".idx"};
+    {
+        std::ifstream is{"resources/CompoundFile.jdx", std::ios::binary};
+        std::ofstream os{path, std::ios::binary};
+        os << is.rdbuf();
+    }
+    std::remove(indexPath.c_str());
+    const libjdx::jdx::ParseOptions options{true, 1, true};
+    auto expected = libjdx::jdx::JdxParser::parse(path);
+
+    // first parse writes the index, second one reads it
+    auto scanned = libjdx::jdx::JdxParser::parse(path, options);
+    REQUIRE(std::ifstream{indexPath}.good());
+    auto indexed = libjdx::jdx::JdxParser::parse(path, options);
+
+    requireEqualBlocks(expected, scanned);
+    requireEqualBlocks(expected, indexed);
+
+    std::remove(path.c_str());
+    std::remove(indexPath.c_str());
+}
+
+TEST_CASE("lazy parse with index file records data record offsets",
+    "[JdxParser]")
+{
+    const std::string path{"index_test_data.jdx"};
+    const std::string indexPath{path + ".idx"};
+    std::string content;
+    {
+        std::ifstream is{"resources/SimpleFile.jdx", std::ios::binary};
+        content.assign(std::istreambuf_iterator<char>{is},
+            std::istreambuf_iterator<char>{});
+        std::ofstream os{path, std::ios::binary};
+        os << content;
+    }
+    std::remove(indexPath.c_str());
+    const libjdx::jdx::ParseOptions options{true, 1, true};
+    auto scanned = libjdx::jdx::JdxParser::parse(path, options);
+
+    std::string header;
+    std::string blockLine;
+    std::string line;
+    std::vector<std::string> entries;
+    {
+        std::ifstream is{indexPath};
+        std::getline(is, header);
+        std::getline(is, blockLine);
+        while (std::getline(is, line))
+        {
+            entries.push_back(line);
+        }
+    }
+    // one data record, no nested blocks
+    REQUIRE(blockLine.substr(blockLine.size() - 4) == " 1 0");
+    const auto dataRecordEntry
+        = std::to_string(content.find("##XYDATA=")) + " 6 XYDATA";
+    REQUIRE(entries.back() == dataRecordEntry);
+
+    auto indexed = libjdx::jdx::JdxParser::parse(path, options);
+    REQUIRE(indexed.getXyData().has_value());
+    REQUIRE_FALSE(indexed.getPeakTable().has_value());
+    REQUIRE(indexed.getXyData()->getSpectrum().toPairs()
+            == scanned.getXyData()->getSpectrum().toPairs());
+
+    // remove data record from index => block is not parsed for it
+    {
+        std::ofstream os{indexPath, std::ios::binary};
+        os << header << "\n"
+           << blockLine.substr(0, blockLine.size() - 4) << " 0 0\n";
+        for (size_t i = 0; i + 1 < entries.size(); ++i)
+        {
+            os << entries.at(i) << "\n";
+        }
+    }
+    REQUIRE_FALSE(
+        libjdx::jdx::JdxParser::parse(path, options).getXyData().has_value());
+
+    std::remove(path.c_str());
+    std::remove(indexPath.c_str());
+}
+
+#ifndef __EMSCRIPTEN__
+TEST_CASE("lazy parse with index file supports concurrent index writers",
+    "[JdxParser]")
+{
+    constexpr size_t numThreads = 8;
+    const std::string path{"index_test_concurrent.jdx"};
+    const std::string indexPath{path + ".idx"};
+    {
+        std::ifstream is{"resources/CompoundFile.jdx", std::ios::binary};
+        std::ofstream os{path, std::ios::binary};
+        os << is.rdbuf();
+    }
+    std::remove(indexPath.c_str());
+    const libjdx::jdx::ParseOptions options{true, 1, true};
+    auto expected = libjdx::jdx::JdxParser::parse(path);
+
+    // all threads find no index and write one
+    std::atomic<size_t> numMismatches{0};
+    auto parse = [&]() {
+        auto block = libjdx::jdx::JdxParser::parse(path, options);
+        if (block.getBlocks().size() != expected.getBlocks().size())
+        {
+            ++numMismatches;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(parse);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    REQUIRE(0 == numMismatches);
+
+    // the index written last is complete
+    requireEqualBlocks(expected, libjdx::jdx::JdxParser::parse(path, options));
+
+    std::remove(path.c_str());
+    std::remove(indexPath.c_str());
+}
+#endif
+
+TEST_CASE("lazy parse with index file uses index unless stale", "[JdxParser]")
+{
+    const std::string path{"index_test_simple.jdx"};
+    const std::string indexPath{path + ".idx"};
+    {
+        std::ofstream os{path, std::ios::binary};
+        os << "##TITLE= Test\n"
+              "##JCAMP-DX= 5.00\n"
+              "##END=\n";
+    }
+    std::remove(indexPath.c_str());
+    const libjdx::jdx::ParseOptions options{true, 1, true};
+    REQUIRE("Test"
+            == libjdx::jdx::JdxParser::parse(path, options)
+                   .getLdr("TITLE")
+                   .value()
+                   .getValueView());
+
+    // manipulate index so that TITLE points to the JCAMP-DX LDR
+    std::string header;
+    std::getline(std::ifstream{indexPath}, header);
+    REQUIRE(header.rfind("libjdx-index 2 38 ", 0) == 0);
+    {
+        std::ofstream os{indexPath, std::ios::binary};
+        os << header << "\n"
+           << "0 38 1 2 0 0\n"
+              "14 5 TITLE\n"
+              "14 7 JCAMPDX\n";
+    }
+    REQUIRE("5.00"
+            == libjdx::jdx::JdxParser::parse(path, options)
+                   .getLdr("TITLE")
+                   .value()
+                   .getValueView());
+
+    // stale index (file size changed) => index is ignored and rewritten
+    {
+        std::ofstream os{path, std::ios::binary};
+        os << "##TITLE= Test 2\n"
+              "##JCAMP-DX= 5.00\n"
+              "##END=\n";
+    }
+    REQUIRE("Test 2"
+            == libjdx::jdx::JdxParser::parse(path, options)
+                   .getLdr("TITLE")
+                   .value()
+                   .getValueView());
+    std::getline(std::ifstream{indexPath}, header);
+    REQUIRE(header.rfind("libjdx-index 2 40 ", 0) == 0);
+
+    // malformed index => index is ignored
+    {
+        std::ofstream os{indexPath, std::ios::binary};
+        os << header << "\n"
+           << "0 40 1 x\n";
+    }
+    REQUIRE("Test 2"
+            == libjdx::jdx::JdxParser::parse(path, options)
+                   .getLdr("TITLE")
+                   .value()
+                   .getValueView());
+
+    std::remove(path.c_str());
+    std::remove(indexPath.c_str());
+}
@@ -201,6 +201,17 @@ TEST_CASE("strips line comment", "[util][stripLineComment]")
     REQUIRE(" comment" == comment);
 }
 
+TEST_CASE("strips line comment of string view", "[util][stripLineCommentView]")
+{
+    std::string input{"line start $$ comment "};
+    auto [content, comment]
+        = libjdx::jdx::util::stripLineCommentView(input, true, true);
+
+    REQUIRE("line start" == content);
+    REQUIRE(comment.has_value());
+    REQUIRE("comment" == comment);
+}
+
 TEST_CASE("indicates missing comment with nullopt", "[util][stripLineComment]")
 {
     std::string input{"line content"};
@@ -20,7 +20,9 @@
 
 #include "catch2/catch.hpp"
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 TEST_CASE("parses NTUPLES NMR record", "[NTuples]")
 {
@@ -61,14 +63,15 @@ TEST_CASE("parses NTUPLES NMR record", "[NTuples]")
 
     REQUIRE(2 == nTuples.getNumPages());
     REQUIRE("NMR SPECTRUM" == nTuples.getDataForm());
+    REQUIRE("NMR SPECTRUM" == nTuples.getDataFormView());
 
     REQUIRE(12 == nTuples.getLdrs().size());
-    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabel());
+    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabelView());
     REQUIRE("FREQUENCY,    SPECTRUM/REAL,    SPECTRUM/IMAG, PAGE NUMBER"
-            == nTuples.getLdrs().at(0).getValue());
-    REQUIRE("$CUSTOMLDR" == nTuples.getLdrs().at(11).getLabel());
+            == nTuples.getLdrs().at(0).getValueView());
+    REQUIRE("$CUSTOMLDR" == nTuples.getLdrs().at(11).getLabelView());
     REQUIRE("VAL1,             VAL2,             VAL3,       VAL4,"
-            == nTuples.getLdrs().at(11).getValue());
+            == nTuples.getLdrs().at(11).getValueView());
     REQUIRE(nTuples.getLdrs().at(11).isUserDefined());
 
     const auto& pageN1 = nTuples.getPage(0);
@@ -77,8 +80,9 @@ TEST_CASE("parses NTUPLES NMR record", "[NTuples]")
     REQUIRE(4 == nTuples.getAttributes().size());
     const auto& pageAttrs0 = nTuples.getAttributes().at(0);
     REQUIRE(1 == pageAttrs0.applicationAttributes.size());
-    REQUIRE("$CUSTOMLDR" == pageAttrs0.applicationAttributes.at(0).getLabel());
-    REQUIRE("VAL1" == pageAttrs0.applicationAttributes.at(0).getValue());
+    REQUIRE("$CUSTOMLDR"
+            == pageAttrs0.applicationAttributes.at(0).getLabelView());
+    REQUIRE("VAL1" == pageAttrs0.applicationAttributes.at(0).getValueView());
 
     REQUIRE(pageN1.getDataTable().has_value());
     const auto& pageN1DataTable = pageN1.getDataTable().value();
@@ -172,16 +176,16 @@ TEST_CASE("parses NTUPLES NMR FID record (round robin format)", "[NTuples]")
         "NTUPLES", "nD NMR FID", blockLdrs, reader, nextLine};
 
     REQUIRE(10 == nTuples.getLdrs().size());
-    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabel());
+    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabelView());
     REQUIRE("TIME1,         TIME2,           FID/REAL,        FID/IMAG"
-            == nTuples.getLdrs().at(0).getValue());
+            == nTuples.getLdrs().at(0).getValueView());
 
     REQUIRE(4 == nTuples.getAttributes().size());
     const auto& nTuplesAttrsT1 = nTuples.getAttributes().at(0);
     REQUIRE(1 == nTuplesAttrsT1.applicationAttributes.size());
-    REQUIRE(
-        ".NUCLEUS" == nTuplesAttrsT1.applicationAttributes.at(0).getLabel());
-    REQUIRE("1H" == nTuplesAttrsT1.applicationAttributes.at(0).getValue());
+    REQUIRE(".NUCLEUS"
+            == nTuplesAttrsT1.applicationAttributes.at(0).getLabelView());
+    REQUIRE("1H" == nTuplesAttrsT1.applicationAttributes.at(0).getValueView());
     const auto& nTuplesAttrsR = nTuples.getAttributes().at(2);
     REQUIRE(nTuplesAttrsR.applicationAttributes.empty());
 
@@ -192,8 +196,8 @@ TEST_CASE("parses NTUPLES NMR FID record (round robin format)", "[NTuples]")
     REQUIRE("T1=0.0" == pageT0.getPageVariables());
     const auto& pageLdrs0 = pageT0.getPageLdrs();
     REQUIRE(1 == pageLdrs0.size());
-    REQUIRE("FIRST" == pageLdrs0.at(0).getLabel());
-    REQUIRE("0, 1.0, 10.0, 30.0" == pageLdrs0.at(0).getValue());
+    REQUIRE("FIRST" == pageLdrs0.at(0).getLabelView());
+    REQUIRE("0, 1.0, 10.0, 30.0" == pageLdrs0.at(0).getValueView());
 
     REQUIRE(pageT0.getDataTable().has_value());
     const auto& pageT0DataTable = pageT0.getDataTable().value();
@@ -255,21 +259,21 @@ TEST_CASE(
         "NTUPLES", "nD NMR SPECTRUM", blockLdrs, reader, nextLine};
 
     REQUIRE(10 == nTuples.getLdrs().size());
-    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabel());
+    REQUIRE("VARNAME" == nTuples.getLdrs().at(0).getLabelView());
     REQUIRE("FREQUENCY1,    FREQUENCY2,      SPECTRUM"
-            == nTuples.getLdrs().at(0).getValue());
-    REQUIRE(".NUCLEUS" == nTuples.getLdrs().at(2).getLabel());
-    REQUIRE("1H, 1H" == nTuples.getLdrs().at(2).getValue());
+            == nTuples.getLdrs().at(0).getValueView());
+    REQUIRE(".NUCLEUS" == nTuples.getLdrs().at(2).getLabelView());
+    REQUIRE("1H, 1H" == nTuples.getLdrs().at(2).getValueView());
     REQUIRE(nTuples.getLdrs().at(2).isTechniqueSpecific());
-    REQUIRE("FACTOR" == nTuples.getLdrs().at(9).getLabel());
-    REQUIRE("1.0, 1.0, 1.0" == nTuples.getLdrs().at(9).getValue());
+    REQUIRE("FACTOR" == nTuples.getLdrs().at(9).getLabelView());
+    REQUIRE("1.0, 1.0, 1.0" == nTuples.getLdrs().at(9).getValueView());
 
     REQUIRE(3 == nTuples.getAttributes().size());
     const auto& nTuplesAttrsT1 = nTuples.getAttributes().at(0);
     REQUIRE(1 == nTuplesAttrsT1.applicationAttributes.size());
-    REQUIRE(
-        ".NUCLEUS" == nTuplesAttrsT1.applicationAttributes.at(0).getLabel());
-    REQUIRE("1H" == nTuplesAttrsT1.applicationAttributes.at(0).getValue());
+    REQUIRE(".NUCLEUS"
+            == nTuplesAttrsT1.applicationAttributes.at(0).getLabelView());
+    REQUIRE("1H" == nTuplesAttrsT1.applicationAttributes.at(0).getValueView());
     const auto& nTuplesAttrsR = nTuples.getAttributes().at(2);
     REQUIRE(nTuplesAttrsR.applicationAttributes.empty());
 
@@ -280,8 +284,8 @@ TEST_CASE(
     REQUIRE("F1=0.0" == pageT0.getPageVariables());
     const auto& pageLdrs0 = pageT0.getPageLdrs();
     REQUIRE(1 == pageLdrs0.size());
-    REQUIRE("FIRST" == pageLdrs0.at(0).getLabel());
-    REQUIRE("0, 1.0, 10.0" == pageLdrs0.at(0).getValue());
+    REQUIRE("FIRST" == pageLdrs0.at(0).getLabelView());
+    REQUIRE("0, 1.0, 10.0" == pageLdrs0.at(0).getValueView());
 
     REQUIRE(pageT0.getDataTable().has_value());
     const auto& pageF0DataTable = pageT0.getDataTable().value();
@@ -520,6 +524,13 @@ TEST_CASE("uses block LDRs to fill missing NTUPLES attributes", "[NTuples]")
     REQUIRE(Approx(150.0) == pageT5YAttributes.min.value());
     REQUIRE(Approx(270.0) == pageT5YAttributes.max.value());
     REQUIRE(Approx(3.0) == pageT5YAttributes.factor.value());
+
+    // NTUPLES only keeps the block LDRs merged into the attributes
+    for (const auto& ldr : blockLdrs)
+    {
+        REQUIRE(libjdx::jdx::DataTable::isMergedBlockLdr(ldr.getLabelView()));
+    }
+    REQUIRE_FALSE(libjdx::jdx::DataTable::isMergedBlockLdr("TITLE"));
 }
 
 TEST_CASE(
@@ -724,8 +735,9 @@ TEST_CASE("correctly handles NTUPLES custom variable LDR missing columns",
 
     const auto& attributesX = nTuples.getAttributes().at(0);
     REQUIRE(1 == attributesX.applicationAttributes.size());
-    REQUIRE("$CUSTOMLDR" == attributesX.applicationAttributes.at(0).getLabel());
-    REQUIRE("VAL1" == attributesX.applicationAttributes.at(0).getValue());
+    REQUIRE("$CUSTOMLDR"
+            == attributesX.applicationAttributes.at(0).getLabelView());
+    REQUIRE("VAL1" == attributesX.applicationAttributes.at(0).getValueView());
     const auto& attributesY = nTuples.getAttributes().at(1);
     REQUIRE(attributesY.applicationAttributes.empty());
     const auto& attributesN = nTuples.getAttributes().at(2);
@@ -826,3 +838,304 @@ TEST_CASE("fails for illegal NTUPLES DATA TABLE variable list",
             || Catch::Matchers::Contains(
                 "unexpected", Catch::CaseSensitive::No));
 }
+
+TEST_CASE("parses NTUPLES pages on demand", "[NTuples]")
+{
+    auto nextLine = std::optional<std::string>{"##NTUPLES= NMR SPECTRUM"};
+    // clang-format off
+    std::string input{
+        "##VAR_NAME=   FREQUENCY,    SPECTRUM/REAL,   PAGE NUMBER\n"
+        "##SYMBOL=             X,                R,             N\n"
+        "##VAR_TYPE= INDEPENDENT,        DEPENDENT,          PAGE\n"
+        "##VAR_FORM=        AFFN,             ASDF,          AFFN\n"
+        "##VAR_DIM=            4,                4,             2\n"
+        "##FIRST=            0.1,             50.0,             1\n"
+        "##LAST=            0.25,            105.0,             2\n"
+        "##FACTOR=           0.1,              5.0,             1\n"
+        "##PAGE= N=1\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +10+11\n"
+        "2.0 +20+21\n"
+        "##PAGE= N=2\n"
+        "illegal content\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +30+31\n"
+        "2.0 +40+41\n"
+        "##END NTUPLES= NMR SPECTRUM\n"
+        "##END=\n"};
+    // clang-format on
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+    std::vector<libjdx::jdx::StringLdr> blockLdrs;
+
+    libjdx::jdx::NTuples nTuples{
+        "NTUPLES", "NMR SPECTRUM", blockLdrs, reader, nextLine};
+    REQUIRE("##END=" == nextLine.value());
+    const auto readerPos = reader.tellg();
+
+    // page structure is known without parsing pages
+    REQUIRE(2 == nTuples.getNumPages());
+    REQUIRE_THROWS(nTuples.getPage(2));
+
+    // malformed page content is only detected on access
+    REQUIRE_THROWS(nTuples.getPage(1));
+    REQUIRE(readerPos == reader.tellg());
+
+    const auto& pageN1 = nTuples.getPage(0);
+    REQUIRE(&pageN1 == &nTuples.getPage(0));
+    REQUIRE(readerPos == reader.tellg());
+    REQUIRE("N=1" == pageN1.getPageVariables());
+    auto pageN1Data = pageN1.getDataTable().value().getData();
+    REQUIRE(4 == pageN1Data.size());
+    REQUIRE(Approx(0.1) == pageN1Data.at(0).first);
+    REQUIRE(Approx(50.0) == pageN1Data.at(0).second);
+    REQUIRE(Approx(0.25) == pageN1Data.at(3).first);
+    REQUIRE(Approx(105.0) == pageN1Data.at(3).second);
+}
+
+TEST_CASE("decodes NTUPLES pages into matrix", "[NTuples]")
+{
+    auto numThreads = GENERATE(size_t{1}, size_t{0});
+    auto nextLine = std::optional<std::string>{"##NTUPLES= NMR SPECTRUM"};
+    // clang-format off
+    std::string input{
+        "##VAR_NAME=   FREQUENCY,    SPECTRUM/REAL,    SPECTRUM/IMAG, PAGE NUMBER\n"
+        "##SYMBOL=             X,                R,                I,           N\n"
+        "##VAR_TYPE= INDEPENDENT,        DEPENDENT,        DEPENDENT,        PAGE\n"
+        "##VAR_FORM=        AFFN,             ASDF,             ASDF,        AFFN\n"
+        "##VAR_DIM=            4,                4,                4,           2\n"
+        "##UNITS=             HZ,  ARBITRARY UNITS,  ARBITRARY UNITS,            \n"
+        "##FIRST=            0.1,             50.0,            300.0,           1\n"
+        "##LAST=            0.25,            105.0,            410.0,           2\n"
+        "##FACTOR=           0.1,              5.0,             10.0,           1\n"
+        "##PAGE= N=1\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +10+11\n"
+        "2.0 +20+21\n"
+        "##PAGE= N=2\n"
+        "##DATA TABLE= (X++(I..I)), XYDATA\n"
+        "1.0 +30+31\n"
+        "2.0 +40+41\n"
+        "##END NTUPLES= NMR SPECTRUM\n"
+        "##END=\n"};
+    // clang-format on
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+    std::vector<libjdx::jdx::StringLdr> blockLdrs;
+    libjdx::jdx::NTuples nTuples{
+        "NTUPLES", "NMR SPECTRUM", blockLdrs, reader, nextLine};
+    const auto readerPos = reader.tellg();
+
+    auto matrix = nTuples.decodeMatrix(numThreads);
+
+    REQUIRE(readerPos == reader.tellg());
+    REQUIRE(2 == matrix.rows);
+    REQUIRE(4 == matrix.cols);
+    REQUIRE(8 == matrix.values.size());
+    REQUIRE(Approx(0.1) == matrix.firstX);
+    REQUIRE(Approx(0.25) == matrix.lastX);
+    REQUIRE("FREQUENCY" == matrix.attributes.xAttributes.varName);
+    REQUIRE("HZ" == matrix.attributes.xAttributes.units);
+    REQUIRE(std::vector<std::string>{"N=1", "N=2"} == matrix.pageVariables);
+    const std::vector<double> expected{
+        50.0, 55.0, 100.0, 105.0, 300.0, 310.0, 400.0, 410.0};
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        REQUIRE(Approx(expected.at(i)) == matrix.values.at(i));
+    }
+    // same values as decoding the pages one by one
+    for (size_t row = 0; row < matrix.rows; ++row)
+    {
+        auto data = nTuples.getPage(row).getDataTable().value().getData();
+        for (size_t col = 0; col < matrix.cols; ++col)
+        {
+            REQUIRE(data.at(col).second
+                    == matrix.values.at(row * matrix.cols + col));
+        }
+    }
+}
+
+TEST_CASE("fails to decode NTUPLES pages with different x axes into matrix",
+    "[NTuples]")
+{
+    auto nextLine = std::optional<std::string>{"##NTUPLES= NMR SPECTRUM"};
+    // clang-format off
+    std::string input{
+        "##VAR_NAME=   FREQUENCY,    SPECTRUM/REAL,   PAGE NUMBER\n"
+        "##SYMBOL=             X,                R,             N\n"
+        "##VAR_TYPE= INDEPENDENT,        DEPENDENT,          PAGE\n"
+        "##VAR_FORM=        AFFN,             ASDF,          AFFN\n"
+        "##VAR_DIM=            4,                4,             2\n"
+        "##FIRST=            0.1,             50.0,             1\n"
+        "##LAST=            0.25,            105.0,             2\n"
+        "##FACTOR=           0.1,              5.0,             1\n"
+        "##PAGE= N=1\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +10+11\n"
+        "2.0 +20+21\n"
+        "##PAGE= N=2\n"
+        "##NPOINTS= 2\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +30+31\n"
+        "##END NTUPLES= NMR SPECTRUM\n"
+        "##END=\n"};
+    // clang-format on
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+    std::vector<libjdx::jdx::StringLdr> blockLdrs;
+    libjdx::jdx::NTuples nTuples{
+        "NTUPLES", "NMR SPECTRUM", blockLdrs, reader, nextLine};
+
+    REQUIRE_THROWS_WITH(nTuples.decodeMatrix(),
+        Catch::Matchers::Contains("N=2", Catch::CaseSensitive::No));
+}
+
+TEST_CASE("decodes NTUPLES pages in single pass", "[NTuples]")
+{
+    auto nextLine = std::optional<std::string>{"##NTUPLES= NMR SPECTRUM"};
+    // clang-format off
+    std::string input{
+        "##VAR_NAME=   FREQUENCY,    SPECTRUM/REAL,    SPECTRUM/IMAG, PAGE NUMBER\n"
+        "##SYMBOL=             X,                R,                I,           N\n"
+        "##VAR_TYPE= INDEPENDENT,        DEPENDENT,        DEPENDENT,        PAGE\n"
+        "##VAR_FORM=        AFFN,             ASDF,             ASDF,        AFFN\n"
+        "##VAR_DIM=            4,                4,                4,           3\n"
+        "##FIRST=            0.1,             50.0,            300.0,           1\n"
+        "##LAST=            0.25,            105.0,            410.0,           3\n"
+        "##FACTOR=           0.1,              5.0,             10.0,           1\n"
+        "##PAGE= N=1\n"
+        "##DATA TABLE= (X++(R..R)), XYDATA\n"
+        "1.0 +10+11\n"
+        "2.0 +20+21\n"
+        "##PAGE= N=2\n"
+        "##DATA TABLE= (X++(I..I)), XYDATA\n"
+        "1.0 +30+31\n"
+        "2.0 +40+41\n"
+        "##PAGE= N=3\n"
+        "##END NTUPLES= NMR SPECTRUM\n"
+        "##END=\n"};
+    // clang-format on
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+    std::vector<libjdx::jdx::StringLdr> blockLdrs;
+    libjdx::jdx::NTuples nTuples{
+        "NTUPLES", "NMR SPECTRUM", blockLdrs, reader, nextLine};
+    const auto readerPos = reader.tellg();
+    // mix of parsed and not yet parsed pages
+    const auto& pageN2 = nTuples.getPage(1);
+
+    std::vector<size_t> indices;
+    std::vector<std::vector<double>> yValues;
+    nTuples.decodePages([&](size_t index, const libjdx::jdx::Page& page,
+                            const libjdx::jdx::Spectrum& spectrum) {
+        REQUIRE(&page == &nTuples.getPage(index));
+        indices.push_back(index);
+        yValues.push_back(spectrum.getYValues());
+    });
+
+    REQUIRE(readerPos == reader.tellg());
+    REQUIRE(std::vector<size_t>{0, 1, 2} == indices);
+    REQUIRE(&pageN2 == &nTuples.getPage(1));
+    for (size_t i = 0; i < 2; ++i)
+    {
+        auto data = nTuples.getPage(i).getDataTable().value().getSpectrum();
+        REQUIRE(data.getYValues() == yValues.at(i));
+    }
+    REQUIRE(Approx(105.0) == yValues.at(0).at(3));
+    REQUIRE(Approx(410.0) == yValues.at(1).at(3));
+    // no DATA TABLE
+    REQUIRE(yValues.at(2).empty());
+}
+
+#ifndef __EMSCRIPTEN__
+TEST_CASE("parses NTUPLES pages on demand concurrently", "[NTuples]")
+{
+    const size_t numPages = 16;
+    const size_t numThreads = 8;
+    // clang-format off
+    std::string input{
+        "##VAR_NAME=   FREQUENCY,    SPECTRUM/REAL,   PAGE NUMBER\n"
+        "##SYMBOL=             X,                R,             N\n"
+        "##VAR_TYPE= INDEPENDENT,        DEPENDENT,          PAGE\n"
+        "##VAR_FORM=        AFFN,             AFFN,          AFFN\n"
+        "##VAR_DIM=            4,                4,            16\n"
+        "##FIRST=            0.1,              0.0,             1\n"
+        "##LAST=            0.25,             10.0,            16\n"
+        "##FACTOR=           0.1,              1.0,             1\n"};
+    // clang-format on
+    for (size_t page = 0; page < numPages; ++page)
+    {
+        const auto y = std::to_string(page);
+        input += "##PAGE= N=" + std::to_string(page + 1) + "\n"
+                 + "##DATA TABLE= (X++(R..R)), XYDATA\n" + "1.0 " + y + " "
+                 + y + "\n" + "2.0 " + y + " " + y + "\n";
+    }
+    input += "##END NTUPLES= NMR SPECTRUM\n"
+             "##END=\n";
+    auto parseNTuples = [&input](libjdx::io::TextReader& reader) {
+        auto nextLine = std::optional<std::string>{"##NTUPLES= NMR SPECTRUM"};
+        std::vector<libjdx::jdx::StringLdr> blockLdrs;
+        return libjdx::jdx::NTuples{
+            "NTUPLES", "NMR SPECTRUM", blockLdrs, reader, nextLine};
+    };
+    auto createReader = [&input]() {
+        auto streamPtr
+            = std::make_unique<std::stringstream>(std::ios_base::in);
+        streamPtr->str(input);
+        return libjdx::io::TextReader{std::move(streamPtr)};
+    };
+    auto expectedReader = createReader();
+    const auto expectedNTuples = parseNTuples(expectedReader);
+    const auto expectedMatrix = expectedNTuples.decodeMatrix();
+    auto reader = createReader();
+    REQUIRE(reader.canCreateCursor());
+    const auto nTuples = parseNTuples(reader);
+    const auto readerPos = reader.tellg();
+
+    // Catch2 assertions are not thread-safe => count mismatches
+    std::atomic<size_t> numMismatches{0};
+    auto access = [&](size_t threadIndex) {
+        if (threadIndex % 2 == 1)
+        {
+            if (nTuples.decodeMatrix().values != expectedMatrix.values)
+            {
+                ++numMismatches;
+            }
+            return;
+        }
+        for (size_t i = 0; i < numPages; ++i)
+        {
+            // threads access the same and different pages at the same time
+            const auto index = (threadIndex + i) % numPages;
+            const auto& page = nTuples.getPage(index);
+            const auto& expectedPage = expectedNTuples.getPage(index);
+            if (page.getPageVariables() != expectedPage.getPageVariables()
+                || page.getDataTable().value().getData()
+                       != expectedPage.getDataTable().value().getData())
+            {
+                ++numMismatches;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(access, t);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(0 == numMismatches);
+    REQUIRE(readerPos == reader.tellg());
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        REQUIRE(&nTuples.getPage(i) == &nTuples.getPage(i));
+    }
+}
+#endif
@@ -0,0 +1,167 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/NumberParser.hpp"
+#include "jdx/ParseException.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+
+TEST_CASE("parses AFFN doubles", "[util][NumberParser]")
+{
+    double value{};
+
+    REQUIRE(3 == libjdx::jdx::util::parseDouble("123", value));
+    REQUIRE(123.0 == value);
+    REQUIRE(5 == libjdx::jdx::util::parseDouble("-1.25", value));
+    REQUIRE(-1.25 == value);
+    REQUIRE(3 == libjdx::jdx::util::parseDouble("+.5;", value));
+    REQUIRE(0.5 == value);
+    REQUIRE(2 == libjdx::jdx::util::parseDouble("1.", value));
+    REQUIRE(1.0 == value);
+    REQUIRE(8 == libjdx::jdx::util::parseDouble("1.5E+003", value));
+    REQUIRE(1500.0 == value);
+    REQUIRE(6 == libjdx::jdx::util::parseDouble("25e-01", value));
+    REQUIRE(2.5 == value);
+    REQUIRE(4 == libjdx::jdx::util::parseDouble("-0.0", value));
+    REQUIRE(0.0 == value);
+    REQUIRE(std::signbit(value));
+}
+
+TEST_CASE("does not consume incomplete exponents", "[util][NumberParser]")
+{
+    double value{};
+
+    REQUIRE(1 == libjdx::jdx::util::parseDouble("2E", value));
+    REQUIRE(2.0 == value);
+    REQUIRE(1 == libjdx::jdx::util::parseDouble("3e+", value));
+    REQUIRE(3.0 == value);
+    REQUIRE(1 == libjdx::jdx::util::parseDouble("4E-X", value));
+    REQUIRE(4.0 == value);
+}
+
+TEST_CASE("rejects illegal doubles without throwing", "[util][NumberParser]")
+{
+    double value = 42.0;
+
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("-", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble(".", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("+.E1", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble(" 1", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("abc", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("1e400", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("-1e400", value));
+    REQUIRE(0 == libjdx::jdx::util::parseDouble("1e-400", value));
+    REQUIRE(42.0 == value);
+}
+
+TEST_CASE("parses doubles correctly rounded", "[util][NumberParser]")
+{
+    double value{};
+
+    // 2^53 + 1 is halfway between two doubles, rounds to even
+    REQUIRE(16 == libjdx::jdx::util::parseDouble("9007199254740993", value));
+    REQUIRE(9007199254740992.0 == value);
+    REQUIRE(16 == libjdx::jdx::util::parseDouble("9007199254740995", value));
+    REQUIRE(9007199254740996.0 == value);
+    // more than 19 significant digits
+    REQUIRE(24
+            == libjdx::jdx::util::parseDouble(
+                "9007199254740993.0000001", value));
+    REQUIRE(9007199254740994.0 == value);
+    REQUIRE(22
+            == libjdx::jdx::util::parseDouble("0.30000000000000001665", value));
+    REQUIRE(0.3 == value);
+    REQUIRE(23
+            == libjdx::jdx::util::parseDouble(
+                "1.7976931348623157e+308", value));
+    REQUIRE(std::numeric_limits<double>::max() == value);
+    REQUIRE(23
+            == libjdx::jdx::util::parseDouble(
+                "2.2250738585072014e-308", value));
+    REQUIRE(std::numeric_limits<double>::min() == value);
+}
+
+TEST_CASE("parses doubles like strtod", "[util][NumberParser]")
+{
+    // deterministic
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint64_t> mantissaDistribution{};
+    std::uniform_int_distribution<int> digitsDistribution{1, 19};
+    std::uniform_int_distribution<int> exponentDistribution{-300, 300};
+    std::array<char, 64> buffer{};
+
+    for (int i = 0; i < 100'000; ++i)
+    {
+        const auto digits = digitsDistribution(generator);
+        const auto mantissa = std::to_string(mantissaDistribution(generator))
+                                  .substr(0, static_cast<size_t>(digits));
+        const auto exponent = exponentDistribution(generator);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        const auto length = std::snprintf(buffer.data(), buffer.size(),
+            "%s.%se%d", mantissa.substr(0, 1).c_str(),
+            mantissa.substr(1).c_str(), exponent);
+        const std::string input{buffer.data(), static_cast<size_t>(length)};
+
+        double value{};
+        const auto numParsed = libjdx::jdx::util::parseDouble(input, value);
+        const auto expected = std::strtod(input.c_str(), nullptr);
+
+        INFO(input);
+        REQUIRE(input.size() == numParsed);
+        REQUIRE(expected == value);
+    }
+}
+
+TEST_CASE("parses unsigned integers", "[util][NumberParser]")
+{
+    uint64_t value = 42;
+
+    REQUIRE(3 == libjdx::jdx::util::parseUInt64("123", value));
+    REQUIRE(123 == value);
+    REQUIRE(3 == libjdx::jdx::util::parseUInt64("+12.5", value));
+    REQUIRE(12 == value);
+    REQUIRE(20
+            == libjdx::jdx::util::parseUInt64("18446744073709551615", value));
+    REQUIRE(std::numeric_limits<uint64_t>::max() == value);
+
+    REQUIRE(0 == libjdx::jdx::util::parseUInt64("18446744073709551616", value));
+    REQUIRE(0 == libjdx::jdx::util::parseUInt64("-1", value));
+    REQUIRE(0 == libjdx::jdx::util::parseUInt64("", value));
+    REQUIRE(0 == libjdx::jdx::util::parseUInt64("a1", value));
+    REQUIRE(std::numeric_limits<uint64_t>::max() == value);
+}
+
+TEST_CASE("converts strings to numbers", "[util][NumberParser]")
+{
+    REQUIRE(-1.5 == libjdx::jdx::util::toDouble(" \t-1.5 units"));
+    REQUIRE(1024 == libjdx::jdx::util::toUInt64(" 1024 "));
+
+    REQUIRE_THROWS_AS(
+        libjdx::jdx::util::toDouble("x"), libjdx::jdx::ParseException);
+    REQUIRE_THROWS_AS(
+        libjdx::jdx::util::toDouble("1e999"), libjdx::jdx::ParseException);
+    REQUIRE_THROWS_AS(
+        libjdx::jdx::util::toUInt64("-1"), libjdx::jdx::ParseException);
+}
@@ -505,3 +505,30 @@ TEST_CASE(
 
     REQUIRE(data.empty());
 }
+
+TEST_CASE("parses PEAK ASSIGNMENTS with commas and brackets in assignment",
+    "[PeakAssignments]")
+{
+    // "##PEAKASSIGNMENTS= (XYA)\r\n"
+    const auto* label = "PEAKASSIGNMENTS";
+    const auto* variables = "(XYA)";
+    std::string input{"(1.0, 10.0, <assignment <1>, 2> )\r\n"
+                      "(2.0, <assignment 3, 4>)\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    auto nextLine = std::optional<std::string>{};
+    auto assignments
+        = libjdx::jdx::PeakAssignments(label, variables, reader, nextLine);
+    auto data = assignments.getData();
+
+    REQUIRE(2 == data.size());
+    REQUIRE(1.0 == Approx(data.at(0).x));
+    REQUIRE(10.0 == Approx(data.at(0).y.value()));
+    REQUIRE("assignment <1>, 2" == data.at(0).a);
+    REQUIRE(2.0 == Approx(data.at(1).x));
+    REQUIRE_FALSE(data.at(1).y.has_value());
+    REQUIRE("assignment 3, 4" == data.at(1).a);
+}
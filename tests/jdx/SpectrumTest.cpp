@@ -0,0 +1,73 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "jdx/Spectrum.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("computes implicit equidistant x values", "[Spectrum]")
+{
+    libjdx::jdx::Spectrum spectrum{10.0, 4.0, {1.0, 2.0, 3.0, 4.0}};
+
+    REQUIRE(4 == spectrum.size());
+    REQUIRE_FALSE(spectrum.empty());
+    REQUIRE(spectrum.hasImplicitX());
+    REQUIRE(10.0 == spectrum.getFirstX());
+    REQUIRE(-2.0 == spectrum.getXIncrement());
+    REQUIRE(8.0 == spectrum.getX(1));
+    REQUIRE(4.0 == spectrum.getX(3));
+    REQUIRE(3.0 == spectrum.getY(2));
+    REQUIRE(std::vector<double>{10.0, 8.0, 6.0, 4.0} == spectrum.getXValues());
+    REQUIRE(std::vector<std::pair<double, double>>{
+                {10.0, 1.0}, {8.0, 2.0}, {6.0, 3.0}, {4.0, 4.0}}
+            == spectrum.toPairs());
+    REQUIRE_THROWS_AS(spectrum.getX(4), std::out_of_range);
+    REQUIRE_THROWS_AS(spectrum.getY(4), std::out_of_range);
+}
+
+TEST_CASE("handles implicit x values for zero and one points", "[Spectrum]")
+{
+    libjdx::jdx::Spectrum empty{};
+    libjdx::jdx::Spectrum noPoints{1.0, 2.0, {}};
+    libjdx::jdx::Spectrum onePoint{5.0, 5.0, {7.0}};
+
+    REQUIRE(empty.empty());
+    REQUIRE(empty.toPairs().empty());
+    REQUIRE(noPoints.empty());
+    REQUIRE(noPoints.getXValues().empty());
+    REQUIRE(1 == onePoint.size());
+    REQUIRE(5.0 == onePoint.getX(0));
+    REQUIRE(7.0 == onePoint.getY(0));
+}
+
+TEST_CASE("stores explicit x values", "[Spectrum]")
+{
+    libjdx::jdx::Spectrum spectrum{{1.0, 3.0, 7.0}, {10.0, 30.0, 70.0}};
+
+    REQUIRE(3 == spectrum.size());
+    REQUIRE_FALSE(spectrum.hasImplicitX());
+    REQUIRE(3.0 == spectrum.getX(1));
+    REQUIRE(std::vector<double>{1.0, 3.0, 7.0}
+            == spectrum.getExplicitXValues());
+    REQUIRE(std::vector<double>{10.0, 30.0, 70.0} == spectrum.getYValues());
+    REQUIRE_THROWS_AS(spectrum.getX(3), std::out_of_range);
+    REQUIRE_THROWS_AS(
+        libjdx::jdx::Spectrum({1.0, 2.0}, {1.0}), std::invalid_argument);
+}
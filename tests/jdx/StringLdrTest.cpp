@@ -19,6 +19,10 @@
 
 #include "catch2/catch.hpp"
 
+#include <array>
+#include <functional>
+#include <memory_resource>
+
 TEST_CASE("LDR is initialized with two both arguments", "[StringLdr]")
 {
     std::string label{"LABEL"};
@@ -26,9 +30,54 @@ TEST_CASE("LDR is initialized with two both arguments", "[StringLdr]")
 
     auto ldr = libjdx::jdx::StringLdr{label, value};
 
-    REQUIRE(label == ldr.getLabel());
-    REQUIRE(value == ldr.getValue());
+    REQUIRE(label == ldr.getLabelView());
+    REQUIRE(value == ldr.getValueView());
+}
+
+TEST_CASE("LDR text is allocated from memory resource, copies own their text",
+    "[StringLdr]")
+{
+    std::array<char, 1024> buffer{};
+    std::pmr::monotonic_buffer_resource resource{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    auto isInBuffer = [&buffer](std::string_view text) {
+        const auto* begin = buffer.data();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto* end = buffer.data() + buffer.size();
+        return std::less_equal<const char*>{}(begin, text.data())
+               && std::less<const char*>{}(text.data(), end);
+    };
+    // long enough to not fit into a small string buffer
+    std::string label{"$USER_DEFINED_LONG_LABEL"};
+    std::string value{"a value that is longer than a small string"};
+
+    auto ldr = libjdx::jdx::StringLdr{label, value, &resource};
+    auto copy = ldr;
+
+    REQUIRE(label == ldr.getLabelView());
+    REQUIRE(value == ldr.getValueView());
+    REQUIRE(isInBuffer(ldr.getLabelView()));
+    REQUIRE(isInBuffer(ldr.getValueView()));
+    REQUIRE(label == copy.getLabelView());
+    REQUIRE(value == copy.getValueView());
+    REQUIRE_FALSE(isInBuffer(copy.getLabelView()));
+    REQUIRE_FALSE(isInBuffer(copy.getValueView()));
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+TEST_CASE("deprecated LDR accessors return copies of the text", "[StringLdr]")
+{
+    auto ldr = libjdx::jdx::StringLdr{"$USER_DEFINED_LABEL", "user value"};
+
+    REQUIRE("$USER_DEFINED_LABEL" == ldr.getLabel());
+    REQUIRE("user value" == ldr.getValue());
 }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
 
 TEST_CASE("user defined LDRs are recognized", "[StringLdr]")
 {
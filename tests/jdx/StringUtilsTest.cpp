@@ -53,6 +53,14 @@ TEST_CASE("trims white space", "[util][trim]")
     REQUIRE(expect == actual);
 }
 
+TEST_CASE("trims white space of string view", "[util][trimView]")
+{
+    std::string input{"\t\n\v\f\r abc \t\n\v\f\r"};
+
+    REQUIRE("abc" == libjdx::jdx::util::trimView(input));
+    REQUIRE(libjdx::jdx::util::trimView(" \t ").empty());
+}
+
 TEST_CASE("white spaces recognized", "[util][isSpace]")
 {
     std::string actual{" \t\n\v\f\raA\x80\xFF"};
@@ -114,3 +122,12 @@ TEST_CASE("split returns full string if no delimiter present", "[util][split]")
 
     REQUIRE(expected == output);
 }
+
+TEST_CASE("split treats delimiter literally", "[util][split]")
+{
+    const std::string fixture{"a.*b.*.*c"};
+    const std::vector<std::string> expected{"a", "b", "", "c"};
+    const auto output = libjdx::jdx::util::split(fixture, ".*");
+
+    REQUIRE(expected == output);
+}
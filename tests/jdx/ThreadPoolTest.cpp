@@ -0,0 +1,78 @@
+/* Copyright (C) 2025 Robert Schiwon
+ *
+ * This file is part of libjdx.
+ *
+ * libjdx is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * libjdx is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libjdx. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "util/ThreadPool.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("calls function once for each index", "[ThreadPool]")
+{
+    libjdx::jdx::util::ThreadPool pool{3};
+    std::vector<std::atomic<int>> calls(1000);
+
+    pool.forEach(calls.size(), 4, [&calls](size_t index) { ++calls[index]; });
+
+    REQUIRE(4 == pool.getNumThreads());
+    for (const auto& count : calls)
+    {
+        REQUIRE(1 == count);
+    }
+}
+
+TEST_CASE("executes work on calling thread without workers", "[ThreadPool]")
+{
+    libjdx::jdx::util::ThreadPool pool{0};
+    std::vector<int> calls(10);
+
+    pool.forEach(calls.size(), 8, [&calls](size_t index) { ++calls[index]; });
+
+    REQUIRE(1 == pool.getNumThreads());
+    REQUIRE(std::vector<int>(10, 1) == calls);
+}
+
+TEST_CASE("rethrows exception of lowest index", "[ThreadPool]")
+{
+    libjdx::jdx::util::ThreadPool pool{2};
+    std::atomic<int> calls{0};
+
+    auto func = [&calls](size_t index) {
+        ++calls;
+        if (index == 3 || index == 7)
+        {
+            throw std::runtime_error(std::to_string(index));
+        }
+    };
+
+    REQUIRE_THROWS_WITH(pool.forEach(10, 3, func), "3");
+    REQUIRE(10 == calls);
+}
+
+TEST_CASE("supports nested work", "[ThreadPool]")
+{
+    libjdx::jdx::util::ThreadPool pool{2};
+    std::atomic<int> calls{0};
+
+    pool.forEach(8, 3, [&pool, &calls](size_t) {
+        pool.forEach(8, 3, [&calls](size_t) { ++calls; });
+    });
+
+    REQUIRE(64 == calls);
+}
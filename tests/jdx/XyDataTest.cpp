@@ -20,7 +20,10 @@
 
 #include "catch2/catch.hpp"
 
+#include <array>
+#include <cmath>
 #include <sstream>
+#include <stdexcept>
 
 TEST_CASE(
     "parses AFFN (X++(Y..Y)) data with required parameters only", "[XyData]")
@@ -461,3 +464,88 @@ TEST_CASE("accepts (XY..XY) for XYDATA variable list", "[XyData][quirk]")
     REQUIRE_FALSE(params.deltaX.has_value());
     REQUIRE_FALSE(params.resolution.has_value());
 }
+
+TEST_CASE("provides (X++(Y..Y)) data with implicit x values", "[XyData]")
+{
+    // "##XYDATA= (X++(Y..Y))\r\n"
+    const auto* label = "XYDATA";
+    const auto* variables = "(X++(Y..Y))";
+    std::string input{"450.0, 10.0, 11.0\r\n"
+                      "452.0, 12.0\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "450.0");
+    ldrs.emplace_back("LASTX", "452.0");
+    ldrs.emplace_back("XFACTOR", "1.0");
+    ldrs.emplace_back("YFACTOR", "2.0");
+    ldrs.emplace_back("NPOINTS", "3");
+    auto nextLine = std::optional<std::string>{};
+    auto xyDataRecord
+        = libjdx::jdx::XyData(label, variables, ldrs, reader, nextLine);
+
+    auto spectrum = xyDataRecord.getSpectrum();
+
+    REQUIRE(3 == spectrum.size());
+    REQUIRE(spectrum.hasImplicitX());
+    REQUIRE(spectrum.getExplicitXValues().empty());
+    REQUIRE(std::vector<double>{450.0, 451.0, 452.0} == spectrum.getXValues());
+    REQUIRE(std::vector<double>{20.0, 22.0, 24.0} == spectrum.getYValues());
+    REQUIRE(xyDataRecord.getData() == spectrum.toPairs());
+}
+
+TEST_CASE("decodes (X++(Y..Y)) data into caller buffers", "[XyData]")
+{
+    // "##XYDATA= (X++(Y..Y))\r\n"
+    const auto* label = "XYDATA";
+    const auto* variables = "(X++(Y..Y))";
+    std::string input{"450.0 A0J0\r\n"
+                      "451.0 B0A5?\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "450.0");
+    ldrs.emplace_back("LASTX", "453.0");
+    ldrs.emplace_back("XFACTOR", "1.0");
+    ldrs.emplace_back("YFACTOR", "0.5");
+    ldrs.emplace_back("NPOINTS", "4");
+    auto nextLine = std::optional<std::string>{};
+    auto xyDataRecord
+        = libjdx::jdx::XyData(label, variables, ldrs, reader, nextLine);
+    const auto expected = xyDataRecord.getData();
+
+    std::array<double, 5> x{};
+    std::array<double, 5> y{};
+    REQUIRE(4 == xyDataRecord.decodeInto(x.data(), y.data(), x.size()));
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        REQUIRE(expected.at(i).first == x.at(i));
+        if (std::isnan(expected.at(i).second))
+        {
+            REQUIRE(std::isnan(y.at(i)));
+            continue;
+        }
+        REQUIRE(expected.at(i).second == y.at(i));
+    }
+
+    std::array<double, 4> yOnly{};
+    REQUIRE(4 == xyDataRecord.decodeInto(nullptr, yOnly.data(), yOnly.size()));
+    REQUIRE(5.0 == yOnly.at(0));
+    REQUIRE(7.5 == yOnly.at(2));
+    REQUIRE(std::isnan(yOnly.at(3)));
+
+    std::array<double, 3> tooSmall{};
+    REQUIRE_THROWS_AS(xyDataRecord.decodeInto(
+                          tooSmall.data(), tooSmall.data(), tooSmall.size()),
+        std::invalid_argument);
+}
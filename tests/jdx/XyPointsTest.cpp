@@ -20,7 +20,10 @@
 
 #include "catch2/catch.hpp"
 
+#include <array>
+#include <cmath>
 #include <sstream>
+#include <stdexcept>
 
 TEST_CASE("parses unevenly spaced (XY..XY) data", "[XyPoints]")
 {
@@ -256,3 +259,76 @@ TEST_CASE("fails parsing ? as X value", "[XyPoints]")
         Catch::Matchers::Contains("NaN", Catch::CaseSensitive::No)
             && Catch::Matchers::Contains("x value", Catch::CaseSensitive::No));
 }
+
+TEST_CASE("provides (XY..XY) data with explicit x values", "[XyPoints]")
+{
+    // "##XYPOINTS= (XY..XY)\r\n"
+    const auto* label = "XYPOINTS";
+    const auto* variables = "(XY..XY)";
+    std::string input{"450.0, 10.0; 451.0, 11.0\r\n"
+                      "460.0, 20.0\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "900.0");
+    ldrs.emplace_back("LASTX", "920.0");
+    ldrs.emplace_back("XFACTOR", "2.0");
+    ldrs.emplace_back("YFACTOR", "10.0");
+    ldrs.emplace_back("NPOINTS", "3");
+    auto nextLine = std::optional<std::string>{};
+    auto xyPointsRecord
+        = libjdx::jdx::XyPoints(label, variables, ldrs, reader, nextLine);
+
+    auto spectrum = xyPointsRecord.getSpectrum();
+
+    REQUIRE(3 == spectrum.size());
+    REQUIRE_FALSE(spectrum.hasImplicitX());
+    REQUIRE(std::vector<double>{900.0, 902.0, 920.0}
+            == spectrum.getExplicitXValues());
+    REQUIRE(spectrum.getExplicitXValues() == spectrum.getXValues());
+    REQUIRE(std::vector<double>{100.0, 110.0, 200.0} == spectrum.getYValues());
+    REQUIRE(xyPointsRecord.getData() == spectrum.toPairs());
+}
+
+TEST_CASE("decodes (XY..XY) data into caller buffers", "[XyPoints]")
+{
+    // "##XYPOINTS= (XY..XY)\r\n"
+    const auto* label = "XYPOINTS";
+    const auto* variables = "(XY..XY)";
+    std::string input{"450.0, 10.0; 451.0, 11.0\r\n"
+                      "460.0, ?\r\n"
+                      "##END="};
+    auto streamPtr = std::make_unique<std::stringstream>(std::ios_base::in);
+    streamPtr->str(input);
+    libjdx::io::TextReader reader{std::move(streamPtr)};
+
+    std::vector<libjdx::jdx::StringLdr> ldrs;
+    ldrs.emplace_back("XUNITS", "1/CM");
+    ldrs.emplace_back("YUNITS", "ABSORBANCE");
+    ldrs.emplace_back("FIRSTX", "900.0");
+    ldrs.emplace_back("LASTX", "920.0");
+    ldrs.emplace_back("XFACTOR", "2.0");
+    ldrs.emplace_back("YFACTOR", "10.0");
+    ldrs.emplace_back("NPOINTS", "3");
+    auto nextLine = std::optional<std::string>{};
+    auto xyPointsRecord
+        = libjdx::jdx::XyPoints(label, variables, ldrs, reader, nextLine);
+
+    std::array<double, 3> x{};
+    std::array<double, 3> y{};
+    REQUIRE(3 == xyPointsRecord.decodeInto(x.data(), y.data(), x.size()));
+    REQUIRE(std::array<double, 3>{900.0, 902.0, 920.0} == x);
+    REQUIRE(100.0 == y.at(0));
+    REQUIRE(110.0 == y.at(1));
+    REQUIRE(std::isnan(y.at(2)));
+
+    REQUIRE_THROWS_AS(xyPointsRecord.decodeInto(x.data(), y.data(), 2),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        xyPointsRecord.decodeInto(x.data(), nullptr, 3), std::invalid_argument);
+}